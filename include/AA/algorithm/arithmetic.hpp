@@ -7,6 +7,27 @@
 
 namespace aa {
 
+	namespace detail {
+		// Elementai apdorojami blokais po 64 baitus, kad vidinis ciklas turėtų žinomą iteracijų skaičių ir be
+		// priklausomybių tikrinimo būtų vektorizuotas net AVX-512 registrams. Likę elementai apdorojami po vieną.
+		// in ir out gali sutapti, nes kiekvienas elementas skaitomas ir rašomas tame pačiame indekse.
+		template<class T, class U, class F>
+		constexpr void for_each_lane(const T * const in, U * const out, const size_t count, F f) {
+			constexpr size_t LANES = std::max(64uz / sizeof(T), 1uz);
+			const size_t blocks = count - count % LANES;
+
+			for (size_t i = 0; i != blocks; i += LANES) {
+#pragma GCC ivdep
+				for (size_t j = 0; j != LANES; ++j)
+					out[i + j] = f(in[i + j]);
+			}
+			for (size_t i = blocks; i != count; ++i)
+				out[i] = f(in[i]);
+		}
+	}
+
+
+
 	template<std::floating_point T>
 	constexpr T map(const T value, const T mag1, const T mag2) {
 		return value * (mag2 / mag1);
@@ -27,6 +48,38 @@ namespace aa {
 		return std::fma((value - start1), (mag2 / mag1), start2);
 	}
 
+	// Range versijos keičia elementus vietoje. Kiekvienam elementui kviečiama skaliarinė funkcija, todėl rezultatai
+	// sutampa bit'ais, o vektorizuoja kompiliatorius (std::fma tampa vfmadd tik kai tikslo architektūra turi FMA).
+	template<sized_contiguous_range R>
+		requires (std::floating_point<std_r::range_value_t<R>>)
+	constexpr void map(R && r, const std_r::range_value_t<R> mag1, const std_r::range_value_t<R> mag2) {
+		detail::for_each_lane(std_r::data(r), std_r::data(r), std_r::size(r),
+			[=](const auto value) { return map(value, mag1, mag2); });
+	}
+
+	template<sized_contiguous_range R>
+		requires (std::floating_point<std_r::range_value_t<R>>)
+	constexpr void map(R && r, const pair<std_r::range_value_t<R>> p1, const std_r::range_value_t<R> mag2) {
+		detail::for_each_lane(std_r::data(r), std_r::data(r), std_r::size(r),
+			[=](const auto value) { return map(value, p1, mag2); });
+	}
+
+	template<sized_contiguous_range R>
+		requires (std::floating_point<std_r::range_value_t<R>>)
+	constexpr void map(R && r, const std_r::range_value_t<R> mag1, const pair<std_r::range_value_t<R>> p2) {
+		detail::for_each_lane(std_r::data(r), std_r::data(r), std_r::size(r),
+			[=](const auto value) { return map(value, mag1, p2); });
+	}
+
+	template<sized_contiguous_range R>
+		requires (std::floating_point<std_r::range_value_t<R>>)
+	constexpr void map(R && r, const std_r::range_value_t<R> start1, const std_r::range_value_t<R> mag1,
+		const std_r::range_value_t<R> start2, const std_r::range_value_t<R> mag2)
+	{
+		detail::for_each_lane(std_r::data(r), std_r::data(r), std_r::size(r),
+			[=](const auto value) { return map(value, start1, mag1, start2, mag2); });
+	}
+
 
 
 	// https://en.wikipedia.org/wiki/Product_(mathematics)
@@ -107,6 +160,14 @@ namespace aa {
 		return product<2>(x);
 	}
 
+	// https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
+	// Grąžina reikšmę iš [0, n) kaip ir x % n, bet be dalybos. Rezultatas priklauso nuo vyriausių x bitų, todėl
+	// x turi būti tolygiai pasiskirstęs per visą T intervalą, kitaip nei su x % n.
+	template<std::unsigned_integral T>
+	constexpr T fastrange(const T x, const T n) {
+		return static_cast<T>((next_unsigned_t<T>{x} * n) >> numeric_digits<T>());
+	}
+
 	template<std::integral T>
 	constexpr bool is_even(const T x) {
 		return !remainder<2>(unsign(x));
@@ -156,6 +217,13 @@ namespace aa {
 		}
 	}
 
+	template<size_t N = 1, sized_contiguous_range R>
+		requires (N <= 3 && std::floating_point<std_r::range_value_t<R>>)
+	constexpr void smoothstep(R && r) {
+		detail::for_each_lane(std_r::data(r), std_r::data(r), std_r::size(r),
+			[](const auto x) static { return smoothstep<N>(x); });
+	}
+
 	// https://graphics.stanford.edu/~seander/bithacks.html#IntegerMinOrMax
 	template<std::unsigned_integral T>
 	constexpr T min(const T x, const T y) {
@@ -186,4 +254,53 @@ namespace aa {
 		return b ^ ((x << i) | (x << j));
 	}
 
+	// Range versijos apverčia kiekvieno elemento baitus ar bitus. Ciklas vektorizuojamas, o baitų apvertimą
+	// kompiliatorius paverčia pshufb ar rev instrukcijomis, todėl atskiros realizacijos architektūroms nereikia.
+	template<sized_contiguous_range R>
+		requires (regular_unsigned_integral<std_r::range_value_t<R>>)
+	constexpr void byteswap(R && r) {
+		detail::for_each_lane(std_r::data(r), std_r::data(r), std_r::size(r),
+			[](const auto x) static { return std::byteswap(x); });
+	}
+
+	// out turi būti ne mažesnis nei in.
+	template<sized_contiguous_range R, sized_contiguous_range O>
+		requires (regular_unsigned_integral<std_r::range_value_t<R>> && std::same_as<std_r::range_value_t<R>, std_r::range_value_t<O>>)
+	constexpr void byteswap(const R & in, O && out) {
+		detail::for_each_lane(std_r::data(in), std_r::data(out), std_r::size(in),
+			[](const auto x) static { return std::byteswap(x); });
+	}
+
+	template<sized_contiguous_range R>
+		requires (regular_unsigned_integral<std_r::range_value_t<R>>)
+	constexpr void bitswap(R && r) {
+		detail::for_each_lane(std_r::data(r), std_r::data(r), std_r::size(r),
+			[](const auto x) static { return bitswap(x); });
+	}
+
+	template<sized_contiguous_range R, sized_contiguous_range O>
+		requires (regular_unsigned_integral<std_r::range_value_t<R>> && std::same_as<std_r::range_value_t<R>, std_r::range_value_t<O>>)
+	constexpr void bitswap(const R & in, O && out) {
+		detail::for_each_lane(std_r::data(in), std_r::data(out), std_r::size(in),
+			[](const auto x) static { return bitswap(x); });
+	}
+
+	// Įrašų masyve kiekvieno įrašo T tipo lauko, esančio offset baitų nuo įrašo pradžios, baitai apverčiami vietoje.
+	// Laukai gali būti nesulygiuoti, todėl nuskaitomi ir įrašomi su memcpy.
+	// Jei stride mažesnis nei sizeof(T), laukai persidengtų, todėl tokiu atveju niekas nedaroma.
+	template<regular_unsigned_integral T>
+	constexpr void byteswap_fields(const std::span<std::byte> records, const size_t offset, const size_t stride) {
+		if (stride < sizeof(T) || records.size() < offset + sizeof(T))
+			return;
+
+		const size_t count = (records.size() - offset - sizeof(T)) / stride + 1;
+		std::byte * p = records.data() + offset;
+		for (size_t i = 0; i != count; ++i, p += stride) {
+			T x;
+			__builtin_memcpy(&x, p, sizeof(T));
+			x = std::byteswap(x);
+			__builtin_memcpy(p, &x, sizeof(T));
+		}
+	}
+
 }
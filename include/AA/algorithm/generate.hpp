@@ -25,44 +25,324 @@ namespace aa {
 	//
 	// mag ir off ne generic tipo, nes taip tik apsisunkiname gyvenimą paduodami į funkcijas konstantas.
 	// Naudotojas pats turi sąmoningai atlikti cast, jei jis turi netinkamą tipą.
+	// https://arxiv.org/abs/1805.10941
+	// Jei UNBIASED, naudojamas Lemire beveik be dalybos metodas: sandaugos jaunesnioji pusė parodo ar reikšmė pateko
+	// į šališką intervalo dalį, o dalyba atliekama tik tada, kai jaunesnioji pusė mažesnė už mag, t.y. retai.
+	// Tokiu atveju šališkos reikšmės atmetamos ir generuojamos iš naujo.
 	// [0, mag)
-	template<full_range_generator G>
+	template<bool UNBIASED = false, full_range_generator G>
 	constexpr distribution_result_t<G> int_generate(G & g, const distribution_result_t<G> mag) {
-		return (mag * distribution_result_t<G>{g()}) >> numeric_digits<generator_result_t<G>>();
+		using result_type = generator_result_t<G>;
+		distribution_result_t<G> m = mag * distribution_result_t<G>{g()};
+
+		if constexpr (UNBIASED) {
+			if (static_cast<result_type>(m) < static_cast<result_type>(mag)) {
+				const result_type t = static_cast<result_type>(-static_cast<result_type>(mag)) % static_cast<result_type>(mag);
+				while (static_cast<result_type>(m) < t)
+					m = mag * distribution_result_t<G>{g()};
+			}
+		}
+		return m >> numeric_digits<result_type>();
 	}
 
 	// [off, mag + off)
-	template<full_range_generator G>
+	template<bool UNBIASED = false, full_range_generator G>
 	constexpr distribution_result_t<G> int_generate(G & g, const distribution_result_t<G> off, const distribution_result_t<G> mag) {
-		return int_generate(g, mag) + off;
+		return int_generate<UNBIASED>(g, mag) + off;
 	}
 
 	// {[0, mag1), [0, mag2)}
-	template<full_range_generator G>
+	template<bool UNBIASED = false, full_range_generator G>
 	constexpr pair<distribution_result_t<G>> int_generate_two(G & g, const distribution_result_t<G> mag1, const distribution_result_t<G> mag2) {
-		const distribution_result_t<G> x = int_generate(g, mag1 * mag2);
+		const distribution_result_t<G> x = int_generate<UNBIASED>(g, mag1 * mag2);
 		return {(x / mag2), (x % mag2)};
 	}
 
+	namespace detail {
+		// Pirmą kartą grąžina first, o po to visada max(), kad būtų galima atskirti ar pirma reikšmė buvo atmesta.
+		struct exhaustive_bits_generator {
+			using result_type = uint8_t;
+
+			static consteval result_type min() { return numeric_min; }
+			static consteval result_type max() { return numeric_max; }
+
+			constexpr result_type operator()() { return calls++ ? max() : first; }
+
+			result_type first;
+			size_t calls;
+		};
+
+		// Perrenkamos visos 8 bitų generatoriaus reikšmės. Neskaičiuojant atmestų, kiekvienas [0, mag) skaičius
+		// turi būti gautas lygiai 256 / mag kartų, kitaip UNBIASED metodas būtų šališkas.
+		consteval bool int_generate_is_unbiased(const uint16_t mag) {
+			std::array<size_t, 256> counts = {};
+			for (size_t x = 0; x != counts.size(); ++x) {
+				exhaustive_bits_generator g = {static_cast<uint8_t>(x), 0};
+				const uint16_t r = int_generate<true>(g, mag);
+				if (g.calls == 1)
+					++counts[r];
+			}
+			return std_r::all_of(counts.data(), counts.data() + mag, [mag](const size_t n) { return n == 256 / mag; });
+		}
+	}
+
+	static_assert(detail::int_generate_is_unbiased(1) && detail::int_generate_is_unbiased(3) && detail::int_generate_is_unbiased(7)
+		&& detail::int_generate_is_unbiased(100) && detail::int_generate_is_unbiased(128) && detail::int_generate_is_unbiased(255));
+
 
 
+	namespace detail {
+		// Kai modulis netelpa į T (pvz. 64 bitų generatoriai su double), paliekami tik vyriausi numeric_digits<T>() bitai,
+		// kitaip apvalinant galėtume gauti 1.
+		template<std::floating_point T, real_generatable_by<T> G>
+		constexpr T real_from_int(const generator_result_t<G> x) {
+			if constexpr (generator_modulus_representable_by<G, T>) {
+				return quotient<generator_modulus_v<G>>(T{x});
+			} else {
+				constexpr size_t SHIFT = numeric_digits<generator_result_t<G>>() - numeric_digits<T>();
+				return quotient<int_exp2(numeric_digits<T>())>(static_cast<T>(x >> SHIFT));
+			}
+		}
+
+		// Sveikieji skaičiai generuojami po 64 į buferį, o paverčiami atskirame cikle, kuris vektorizuojamas.
+		template<class G, class R, class F>
+		constexpr void real_generate_range(G & g, R && r, F f) {
+			std::array<generator_result_t<G>, 64> bits;
+			std_r::range_value_t<R> * const out = std_r::data(r);
+			const size_t count = std_r::size(r);
+
+			for (size_t i = 0; i < count; i += bits.size()) {
+				const size_t n = std::min(bits.size(), count - i);
+				for (size_t j = 0; j != n; ++j)
+					bits[j] = int_generate(g);
+				for_each_lane(bits.data(), out + i, n, f);
+			}
+		}
+	}
+
 	// Čia nėra daromas atsitiktinio skaičiaus cast į kažkokį paduotą tipą, nes T negalime nustatyti iš paduoto argumento tipo.
 	// [0, 1)
-	template<std::floating_point T = double, generator_modulus_representable_by<T> G>
+	template<std::floating_point T = double, real_generatable_by<T> G>
 	constexpr T real_generate(G & g) {
-		return quotient<generator_modulus_v<G>>(T{int_generate(g)});
+		return detail::real_from_int<T, G>(int_generate(g));
 	}
 
 	// [0, mag)
-	template<std::floating_point T, generator_modulus_representable_by<T> G>
+	template<std::floating_point T, real_generatable_by<T> G>
 	constexpr T real_generate(G & g, const T mag) {
 		return real_generate<T>(g) * mag;
 	}
 
 	// [off, mag + off)
-	template<std::floating_point T, generator_modulus_representable_by<T> G>
+	template<std::floating_point T, real_generatable_by<T> G>
 	constexpr T real_generate(G & g, const T off, const T mag) {
 		return real_generate(g, mag) + off;
 	}
 
+
+
+	// Užpildo visą masyvą. Generatoriaus seka ir rezultatai sutampa su atitinkamos funkcijos kvietimais kiekvienam elementui,
+	// todėl off ir mag pritaikomi tomis pačiomis operacijomis, o ne atskira fma.
+	// [0, 1)
+	template<sized_contiguous_range R, real_generatable_by<std_r::range_value_t<R>> G>
+		requires (std::floating_point<std_r::range_value_t<R>>)
+	constexpr void real_generate(G & g, R && r) {
+		using T = std_r::range_value_t<R>;
+		detail::real_generate_range(g, r,
+			[](const generator_result_t<G> x) static { return detail::real_from_int<T, G>(x); });
+	}
+
+	// [0, mag)
+	template<sized_contiguous_range R, real_generatable_by<std_r::range_value_t<R>> G>
+		requires (std::floating_point<std_r::range_value_t<R>>)
+	constexpr void real_generate(G & g, R && r, const std_r::range_value_t<R> mag) {
+		using T = std_r::range_value_t<R>;
+		detail::real_generate_range(g, r,
+			[=](const generator_result_t<G> x) { return detail::real_from_int<T, G>(x) * mag; });
+	}
+
+	// [off, mag + off)
+	template<sized_contiguous_range R, real_generatable_by<std_r::range_value_t<R>> G>
+		requires (std::floating_point<std_r::range_value_t<R>>)
+	constexpr void real_generate(G & g, R && r, const std_r::range_value_t<R> off, const std_r::range_value_t<R> mag) {
+		using T = std_r::range_value_t<R>;
+		detail::real_generate_range(g, r,
+			[=](const generator_result_t<G> x) { return (detail::real_from_int<T, G>(x) * mag) + off; });
+	}
+
+
+
+	namespace detail {
+		// https://www.jstatsoft.org/article/view/v005i08
+		// k yra sluoksnio riba, iki kurios reikšmė tikrai po kreive, w paverčia sveikąjį skaičių į x, o f yra tankis sluoksnio viršuje.
+		template<size_t N>
+		struct ziggurat_table {
+			std::array<uint32_t, N> k;
+			std::array<double, N> w, f;
+		};
+
+		consteval ziggurat_table<128> make_normal_ziggurat() {
+			constexpr double m = 2147483648.0, v = 9.91256303526217e-3;
+			double d = 3.442619855899, t = d;
+			const double q = v / std::exp(-0.5 * d * d);
+
+			ziggurat_table<128> z = {};
+			z.k[0] = static_cast<uint32_t>((d / q) * m);
+			z.k[1] = 0;
+			z.w[0] = q / m;
+			z.w[127] = d / m;
+			z.f[0] = 1.0;
+			z.f[127] = std::exp(-0.5 * d * d);
+
+			for (size_t i = 126; i >= 1; --i) {
+				d = std::sqrt(-2.0 * std::log(v / d + std::exp(-0.5 * d * d)));
+				z.k[i + 1] = static_cast<uint32_t>((d / t) * m);
+				t = d;
+				z.f[i] = std::exp(-0.5 * d * d);
+				z.w[i] = d / m;
+			}
+			return z;
+		}
+
+		consteval ziggurat_table<256> make_exponential_ziggurat() {
+			constexpr double m = 4294967296.0, v = 3.949659822581572e-3;
+			double d = 7.697117470131487, t = d;
+			const double q = v / std::exp(-d);
+
+			ziggurat_table<256> z = {};
+			z.k[0] = static_cast<uint32_t>((d / q) * m);
+			z.k[1] = 0;
+			z.w[0] = q / m;
+			z.w[255] = d / m;
+			z.f[0] = 1.0;
+			z.f[255] = std::exp(-d);
+
+			for (size_t i = 254; i >= 1; --i) {
+				d = -std::log(v / d + std::exp(-d));
+				z.k[i + 1] = static_cast<uint32_t>((d / t) * m);
+				t = d;
+				z.f[i] = std::exp(-d);
+				z.w[i] = d / m;
+			}
+			return z;
+		}
+
+		inline constexpr ziggurat_table<128> normal_ziggurat = make_normal_ziggurat();
+		inline constexpr ziggurat_table<256> exponential_ziggurat = make_exponential_ziggurat();
+
+		// Imami vyriausi 32 bitai ir pasukami taip, kad sluoksnio indeksą sudarytų vyriausi bitai,
+		// nes lcg jauniausių bitų periodas trumpas. Kaip ir originale, indekso bitai sutampa su jauniausiais reikšmės bitais.
+		template<size_t ROTATION, full_range_generator G>
+		constexpr uint32_t ziggurat_bits(G & g) {
+			return std::rotl(static_cast<uint32_t>(g() >> (numeric_digits<generator_result_t<G>>() - 32)), ROTATION);
+		}
+
+		// (0, 1], kad būtų galima logaritmuoti.
+		template<full_range_generator G>
+		constexpr double open_real_generate(G & g) {
+			return 1.0 - real_generate<double>(g);
+		}
+	}
+
+	template<class G>
+	concept ziggurat_generator = full_range_generator<G> && (numeric_digits<generator_result_t<G>>() >= 32);
+
+	// https://en.wikipedia.org/wiki/Ziggurat_algorithm
+	// Marsaglia ir Tsang metodas su 128 sluoksniais. Dažniausiai užtenka vienos reikšmės, vienos daugybos ir palyginimo,
+	// o lentelės apskaičiuojamos kompiliavimo metu, todėl rezultatai nepriklauso nuo platformos standartinės bibliotekos.
+	// Vidurkis 0, standartinis nuokrypis 1.
+	template<std::floating_point T = double, ziggurat_generator G>
+	constexpr T normal_generate(G & g) {
+		constexpr const detail::ziggurat_table<128> & z = detail::normal_ziggurat;
+		constexpr double r = 3.442619855899;
+
+		int32_t hz = sign_cast<int32_t>(detail::ziggurat_bits<7>(g));
+		size_t iz = remainder<128>(unsign(hz));
+		while (true) {
+			const uint32_t a = hz < 0 ? uint32_t{0} - unsign(hz) : unsign(hz);
+			if (a < z.k[iz])
+				return static_cast<T>(hz * z.w[iz]);
+
+			if (!iz) {
+				double x, y;
+				do {
+					x = -std::log(detail::open_real_generate(g)) / r;
+					y = -std::log(detail::open_real_generate(g));
+				} while (y + y < x * x);
+				return static_cast<T>(hz > 0 ? r + x : -r - x);
+			}
+
+			const double x = hz * z.w[iz];
+			if (z.f[iz] + detail::open_real_generate(g) * (z.f[iz - 1] - z.f[iz]) < std::exp(-0.5 * x * x))
+				return static_cast<T>(x);
+
+			hz = sign_cast<int32_t>(detail::ziggurat_bits<7>(g));
+			iz = remainder<128>(unsign(hz));
+		}
+	}
+
+	// Vidurkis 0, standartinis nuokrypis mag.
+	template<std::floating_point T, ziggurat_generator G>
+	constexpr T normal_generate(G & g, const T mag) {
+		return normal_generate<T>(g) * mag;
+	}
+
+	// Vidurkis off, standartinis nuokrypis mag.
+	template<std::floating_point T, ziggurat_generator G>
+	constexpr T normal_generate(G & g, const T off, const T mag) {
+		return normal_generate(g, mag) + off;
+	}
+
+	// Marsaglia ir Tsang metodas su 256 sluoksniais. Vidurkis 1.
+	template<std::floating_point T = double, ziggurat_generator G>
+	constexpr T exponential_generate(G & g) {
+		constexpr const detail::ziggurat_table<256> & z = detail::exponential_ziggurat;
+		constexpr double r = 7.697117470131487;
+
+		uint32_t jz = detail::ziggurat_bits<8>(g);
+		size_t iz = remainder<256>(jz);
+		while (true) {
+			if (jz < z.k[iz])
+				return static_cast<T>(jz * z.w[iz]);
+
+			if (!iz)
+				return static_cast<T>(r - std::log(detail::open_real_generate(g)));
+
+			const double x = jz * z.w[iz];
+			if (z.f[iz] + detail::open_real_generate(g) * (z.f[iz - 1] - z.f[iz]) < std::exp(-x))
+				return static_cast<T>(x);
+
+			jz = detail::ziggurat_bits<8>(g);
+			iz = remainder<256>(jz);
+		}
+	}
+
+	// Vidurkis mag.
+	template<std::floating_point T, ziggurat_generator G>
+	constexpr T exponential_generate(G & g, const T mag) {
+		return exponential_generate<T>(g) * mag;
+	}
+
+	template<std::floating_point T, ziggurat_generator G>
+	constexpr T exponential_generate(G & g, const T off, const T mag) {
+		return exponential_generate(g, mag) + off;
+	}
+
+
+
+	// Užpildo visą masyvą. Atmetimo ciklai nevektorizuojami, todėl tiesiog kviečiama funkcija kiekvienam elementui.
+	template<sized_contiguous_range R, ziggurat_generator G, class... A>
+		requires (std::floating_point<std_r::range_value_t<R>> && (... && std::same_as<A, std_r::range_value_t<R>>) && sizeof...(A) <= 2)
+	constexpr void normal_generate(G & g, R && r, const A... args) {
+		for (std_r::range_value_t<R> & x : r)
+			x = normal_generate<std_r::range_value_t<R>>(g, args...);
+	}
+
+	template<sized_contiguous_range R, ziggurat_generator G, class... A>
+		requires (std::floating_point<std_r::range_value_t<R>> && (... && std::same_as<A, std_r::range_value_t<R>>) && sizeof...(A) <= 2)
+	constexpr void exponential_generate(G & g, R && r, const A... args) {
+		for (std_r::range_value_t<R> & x : r)
+			x = exponential_generate<std_r::range_value_t<R>>(g, args...);
+	}
+
 }
@@ -2,11 +2,252 @@
 
 #include "../metaprogramming/general.hpp"
 #include "arithmetic.hpp"
+#include <numeric>
 
 
 
 namespace aa {
 
+	namespace detail {
+		// https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+		template<class TRAITS>
+		constexpr uint64_t fnv1a_hash(const char_type_in_use_t<TRAITS> * const data, const size_t count) {
+			uint64_t hash = 0xCBF29CE484222325;
+			for (size_t i = 0; i != count; ++i)
+				hash = (hash ^ static_cast<uint64_t>(TRAITS::to_int_type(data[i]))) * 0x100000001B3;
+			return hash;
+		}
+
+		// https://prng.di.unimi.it/splitmix64.c
+		constexpr uint64_t mix64(uint64_t x) {
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EB;
+			return x ^ (x >> 31);
+		}
+
+		template<size_t K>
+		constexpr size_t displaced_position(const uint64_t hash, const uint32_t displacement) {
+			return remainder<K>(mix64(hash ^ (displacement * uint64_t{0x9E3779B97F4A7C15})));
+		}
+
+		template<class U, class C>
+		constexpr U load_word(const C * const p) {
+			U u;
+			__builtin_memcpy(&u, p, sizeof(U));
+			return u;
+		}
+
+		// Lyginama didžiausiais telpančiais žodžiais, o paskutinis žodis persidengia su ankstesniu, kad nereikėtų atskirai
+		// lyginti likučio. Rakto žodžiai gaunami su bit_cast, todėl sutampa su nuskaitytais nepriklausomai nuo baitų tvarkos.
+		// Žodžiais galima lyginti tik jei traits lygina simbolius kaip ==, kitaip ir kompiliavimo metu naudojamas compare.
+		template<auto KEY, class TRAITS>
+		constexpr bool string_words_equal(const char_type_in_use_t<TRAITS> * const data) {
+			using char_type = char_type_in_use_t<TRAITS>;
+			constexpr size_t L = get_tuple_size<t<KEY>>();
+			constexpr size_t BYTES = L * sizeof(char_type);
+
+			if constexpr (!L) {
+				return true;
+			} else {
+				if consteval {
+					return !TRAITS::compare(data, std_r::data(KEY), L);
+				} else {
+					if constexpr (!std::same_as<TRAITS, std::char_traits<char_type>> || !std::integral<char_type>) {
+						return !TRAITS::compare(data, std_r::data(KEY), L);
+					} else {
+						using word_type = type_in_c_t<([] static {
+							/**/ if constexpr (BYTES >= 8)	return c_type<uint64_t>();
+							else if constexpr (BYTES >= 4)	return c_type<uint32_t>();
+							else if constexpr (BYTES >= 2)	return c_type<uint16_t>();
+							else							return c_type<uint8_t>();
+						})()>;
+						constexpr size_t W = sizeof(word_type) / sizeof(char_type);
+
+						constexpr auto [...I] = c<std::make_index_sequence<(L + W - 1) / W>>();
+						return (... && (load_word<word_type>(data + std::min(I * W, L - W)) == c(std::bit_cast<word_type>(
+							([] static consteval {
+								std::array<char_type, W> chunk;
+								std_r::copy_n(std_r::data(KEY) + std::min(I * W, L - W), W, chunk.begin());
+								return chunk;
+							})()))));
+					}
+				}
+			}
+		}
+
+		template<class TRAITS, size_t K, size_t B, size_t L>
+		struct minimal_perfect_hash_table {
+			std::array<uint32_t, B> displacements;
+			std::array<size_t, K> indexes;
+			std::array<size_t, K + 1> offsets;
+			std::array<char_type_in_use_t<TRAITS>, L> chars;
+		};
+
+		// Raktai paskirstomi į B kibirų, kibirai apdorojami nuo didžiausio ir kiekvienam ieškomas toks poslinkis,
+		// kad visi kibiro raktai patektų į dar laisvas vietas. Raktai turi būti skirtingi, kitaip paieška nesibaigtų.
+		template<class TRAITS, fixed_string_like auto... A>
+		consteval auto make_minimal_perfect_hash_table() {
+			constexpr size_t K = sizeof...(A);
+			constexpr size_t B = quotient<4>(K) + 1;
+			constexpr size_t L = (... + get_tuple_size<t<A>>());
+
+			minimal_perfect_hash_table<TRAITS, K, B, L> table = {};
+			const std::array<uint64_t, K> hashes = {fnv1a_hash<TRAITS>(std_r::data(A), std_r::size(A))...};
+
+			size_t offset = 0;
+			constexpr auto [...INDEXES] = c<std::make_index_sequence<K>>();
+			template for (constexpr size_t I : {INDEXES...}) {
+				table.offsets[I] = offset;
+				std_r::copy(AA_EXPAND(A)[I], table.chars.begin() + sign(offset));
+				offset += get_tuple_size<t<A...[I]>>();
+			}
+			table.offsets[K] = offset;
+
+			std::array<size_t, B> sizes = {};
+			for (const uint64_t hash : hashes)
+				++sizes[remainder<B>(hash)];
+
+			std::array<size_t, B> order = {};
+			std_r::iota(order, 0uz);
+			std_r::stable_sort(order, std_r::greater{}, [&](const size_t b) { return sizes[b]; });
+
+			std::array<bool, K> taken = {};
+			std::array<size_t, K> trial = {};
+			for (const size_t b : order) {
+				if (!sizes[b])
+					break;
+
+				for (uint32_t d = 0;; ++d) {
+					size_t count = 0;
+					for (size_t i = 0; i != K; ++i) {
+						if (remainder<B>(hashes[i]) != b)
+							continue;
+
+						const size_t pos = displaced_position<K>(hashes[i], d);
+						if (taken[pos])
+							break;
+
+						taken[pos] = true;
+						table.indexes[pos] = i;
+						trial[count++] = pos;
+					}
+
+					if (count == sizes[b]) {
+						table.displacements[b] = d;
+						break;
+					}
+
+					for (size_t j = 0; j != count; ++j)
+						taken[trial[j]] = false;
+				}
+			}
+			return table;
+		}
+	}
+
+	// https://github.com/wangyi-fudan/wyhash
+	// wyhash final4 versija. Elementai maišomi kaip baitai, todėl T elementai turi būti trivially_copyable ir neturėti užpildo baitų.
+	// Vykdymo metu baitai nuskaitomi žodžiais, o kompiliavimo metu gaunami su bit_cast ir sudedami little-endian tvarka,
+	// todėl abiem atvejais gaunama ta pati maiša. Galima naudoti kaip H parametrą generic_hash ir mod_generic_hash klasėse.
+	template<sized_contiguous_range T>
+		requires (trivially_copyable<std_r::range_value_t<T>>)
+	struct wyhash {
+		// Member types
+		using value_type = std_r::range_value_t<T>;
+
+
+
+		// Member constants
+		static consteval std::array<uint64_t, 4> secret() {
+			return {0x2D358DCCAA6C78A5, 0x8BB84B93962EACC9, 0x4B33A62ED433D4A3, 0x4D5A2DA51DE1AA47};
+		}
+
+
+
+		// Hash function
+		static constexpr size_t operator()(const T & t, uint64_t seed = 0) {
+			const value_type * const data = std_r::data(t);
+			const size_t count = product<sizeof(value_type)>(std_r::size(t));
+			uint64_t a, b;
+
+			seed ^= mix(seed ^ secret()[0], secret()[1]);
+			if (count <= 16) {
+				/**/ if (count >= 4) {
+					const size_t o = quotient<8>(count) << 2;
+					a = (read<uint32_t>(data, 0) << 32) | read<uint32_t>(data, o);
+					b = (read<uint32_t>(data, count - 4) << 32) | read<uint32_t>(data, count - 4 - o);
+				} else if (count) {
+					a = (read_byte(data, 0) << 16) | (read_byte(data, half(count)) << 8) | read_byte(data, count - 1);
+					b = 0;
+				} else {
+					a = b = 0;
+				}
+			} else {
+				size_t o = 0, i = count;
+				if (i > 48) {
+					uint64_t see1 = seed, see2 = seed;
+					do {
+						seed = mix(read<uint64_t>(data, o) ^ secret()[1], read<uint64_t>(data, o + 8) ^ seed);
+						see1 = mix(read<uint64_t>(data, o + 16) ^ secret()[2], read<uint64_t>(data, o + 24) ^ see1);
+						see2 = mix(read<uint64_t>(data, o + 32) ^ secret()[3], read<uint64_t>(data, o + 40) ^ see2);
+						o += 48;
+						i -= 48;
+					} while (i > 48);
+					seed ^= see1 ^ see2;
+				}
+				for (; i > 16; o += 16, i -= 16)
+					seed = mix(read<uint64_t>(data, o) ^ secret()[1], read<uint64_t>(data, o + 8) ^ seed);
+
+				a = read<uint64_t>(data, o + i - 16);
+				b = read<uint64_t>(data, o + i - 8);
+			}
+
+			a ^= secret()[1];
+			b ^= seed;
+			multiply(a, b);
+			return mix(a ^ secret()[0] ^ count, b ^ secret()[1]);
+		}
+
+
+
+	protected:
+		// https://en.wikipedia.org/wiki/Multiply%E2%80%93accumulate_operation
+		static constexpr void multiply(uint64_t & a, uint64_t & b) {
+			const uint128_t r = uint128_t{a} * b;
+			a = static_cast<uint64_t>(r);
+			b = static_cast<uint64_t>(r >> 64);
+		}
+
+		static constexpr uint64_t mix(uint64_t a, uint64_t b) {
+			multiply(a, b);
+			return a ^ b;
+		}
+
+		static constexpr uint64_t read_byte(const value_type * const data, const size_t offset) {
+			return std::bit_cast<std::array<uint8_t, sizeof(value_type)>>(
+				data[quotient<sizeof(value_type)>(offset)])[remainder<sizeof(value_type)>(offset)];
+		}
+
+		// Grąžinamas uint64_t, kad nuskaitytus 32 bitus būtų galima iškart pastumti.
+		template<class U>
+		static constexpr uint64_t read(const value_type * const data, const size_t offset) {
+			if consteval {
+				U u = 0;
+				for (size_t i = 0; i != sizeof(U); ++i)
+					u |= static_cast<U>(read_byte(data, offset + i) << (i * 8));
+				return u;
+			} else {
+				U u;
+				__builtin_memcpy(&u, std::bit_cast<const std::byte *>(data) + offset, sizeof(U));
+				if constexpr (std::endian::native == std::endian::big)
+					u = std::byteswap(u);
+				return u;
+			}
+		}
+	};
+
+
+
 	template<template<class> class H = std::hash>
 	struct generic_hash {
 		template<hashable_by_template<H> T>
@@ -20,17 +261,49 @@ namespace aa {
 
 
 
-	template<size_t N, template<class> class H = std::hash>
+	// Maišos reikšmės sumažinimo į [0, n) būdai. Kai n yra konstanta, remainder_reduction kompiliatorius pakeičia daugyba,
+	// bet kai n žinomas tik vykdymo metu, atliekama tikra dalyba. fastrange_reduction visada naudoja vieną daugybą,
+	// tačiau naudoja vyriausius maišos bitus, todėl netinka su std::hash sveikiesiems skaičiams, kuri grąžina patį skaičių.
+	struct remainder_reduction {
+		static constexpr size_t operator()(const size_t hash, const size_t n) {
+			return hash % n;
+		}
+	};
+
+	struct fastrange_reduction {
+		static constexpr size_t operator()(const size_t hash, const size_t n) {
+			return fastrange(hash, n);
+		}
+	};
+
+	template<size_t N, template<class> class H = std::hash, class R = remainder_reduction>
 	struct mod_generic_hash {
 		template<hashable_by_template<H> T>
 		static constexpr size_t operator()(const T & t) {
-			return remainder<N>(c<H<T>>()(t));
+			if constexpr (std::same_as<R, remainder_reduction>)	return remainder<N>(c<H<T>>()(t));
+			else												return c<R>()(c<H<T>>()(t), N);
 		}
 
 		static consteval size_t max() { return N - 1; }
 		static consteval size_t min() { return 0; }
 	};
 
+	// Kaip mod_generic_hash, bet N nustatomas vykdymo metu, pavyzdžiui kai lentelės dydis keičiasi.
+	template<template<class> class H = std::hash, class R = fastrange_reduction>
+	struct dynamic_mod_generic_hash {
+		template<hashable_by_template<H> T>
+		constexpr size_t operator()(const T & t) const {
+			return c<R>()(c<H<T>>()(t), count);
+		}
+
+		constexpr size_t max() const { return count - 1; }
+		static consteval size_t min() { return 0; }
+
+		constexpr dynamic_mod_generic_hash(const size_t n) : count{n} {}
+
+		size_t count;
+	};
+
 
 
 	// Rekomenduojama naudoti su templates šią klasę kaip tipo parametrą.
@@ -98,4 +371,82 @@ namespace aa {
 		}
 	};
 
+
+
+	// https://cmph.sourceforge.net/papers/esa09.pdf
+	// https://arxiv.org/abs/2104.10402
+	// Kaip string_perfect_hash, bet lentelės sudaromos kompiliavimo metu pagal CHD/PTHash principą, todėl paieška
+	// nepriklauso nuo raktų skaičiaus: apskaičiuojama viena maiša, pagal kibiro poslinkį gaunama vieta lentelėje ir
+	// palyginama tik su toje vietoje esančiu raktu. Jei jis nesutampa, grąžinama max().
+	//
+	// Raktai turi būti skirtingi. Verta naudoti kai raktų daug, su keliais raktais tiesinė paieška greitesnė.
+	template<fixed_string_like auto... A>
+		requires (!!sizeof...(A) && same_as_every<range_char_traits_t<t<A>>...>)
+	struct string_minimal_perfect_hash {
+		using traits_type = range_char_traits_t<t<A>>...[0];
+		using char_type = char_type_in_use_t<traits_type>;
+		using view_type = std::basic_string_view<char_type, traits_type>;
+
+		template<same_range_char_traits_as<traits_type> T>
+		static constexpr size_t operator()(const T & str) {
+			const uint64_t hash = detail::fnv1a_hash<traits_type>(std_r::data(str), std_r::size(str));
+			const size_t pos = detail::displaced_position<max()>(hash, table.displacements[remainder<bucket_count()>(hash)]);
+			const size_t index = table.indexes[pos];
+			return string_equal_to::operator()(str, key(index)) ? index : max();
+		}
+
+		static constexpr view_type key(const size_t index) {
+			return {table.chars.data() + table.offsets[index], table.offsets[index + 1] - table.offsets[index]};
+		}
+
+		static consteval size_t bucket_count() { return quotient<4>(sizeof...(A)) + 1; }
+
+		static consteval size_t max() { return sizeof...(A); }
+		static consteval size_t min() { return 0; }
+
+	protected:
+		static constexpr auto table = detail::make_minimal_perfect_hash_table<traits_type, A...>();
+	};
+
+
+
+	// Kaip string_perfect_hash, bet raktai kompiliavimo metu suskirstomi pagal ilgį, todėl pagal įvesties ilgį per lentelę
+	// iškviečiama funkcija, kuri lygina tik su tokio pat ilgio raktais. Simboliai lyginami žodžiais, o ne po vieną.
+	// Tinka trumpiems raktams, pavyzdžiui HTTP metodams ir antraštėms, kurių ilgiai dažniausiai skiriasi.
+	template<fixed_string_like auto... A>
+		requires (!!sizeof...(A) && same_as_every<range_char_traits_t<t<A>>...>)
+	struct string_length_dispatch_hash {
+		using traits_type = range_char_traits_t<t<A>>...[0];
+		using char_type = char_type_in_use_t<traits_type>;
+
+		template<same_range_char_traits_as<traits_type> T>
+		static constexpr size_t operator()(const T & str) {
+			const size_t count = std_r::size(str);
+			if (count > max_length())
+				return max();
+
+			return constexprify<max_length() + 1>(count, dispatcher{}, std_r::data(str));
+		}
+
+		static consteval size_t max_length() { return std::max({get_tuple_size<t<A>>()...}); }
+
+		static consteval size_t max() { return sizeof...(A); }
+		static consteval size_t min() { return 0; }
+
+	protected:
+		struct dispatcher {
+			template<size_t L>
+			static constexpr size_t operator()(const char_type * const data) {
+				constexpr auto [...INDEXES] = c<std::index_sequence_for<A...>>();
+				template for (constexpr size_t I : {INDEXES...}) {
+					if constexpr (get_tuple_size<t<A...[I]>>() == L) {
+						if (detail::string_words_equal<A...[I], traits_type>(data))
+							return I;
+					}
+				}
+				return max();
+			}
+		};
+	};
+
 }
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "arithmetic.hpp"
+
+
+
+namespace aa {
+
+	// https://gmplib.org/~tege/divcnst-pldi94.pdf
+	// https://libdivide.com/
+	// quotient<X> ir remainder<X> dalybą pakeičia daugyba tik kai daliklis žinomas kompiliavimo metu. Ši klasė tą patį
+	// padaro su dalikliu, kuris žinomas tik vykdymo metu, bet nesikeičia, pavyzdžiui nuskaitytu iš konfigūracijos.
+	// Konstruktoriuje viena dalyba apskaičiuojamas magiškas skaičius, o po to kiekviena dalyba yra daugyba ir postūmiai.
+	//
+	// Naudojamas Granlund-Montgomery algoritmas su N+1 bitų magišku skaičiumi, kurio vyriausias bitas pridedamas
+	// atskirai, todėl tinka visiems dalikliams, įskaitant 1. Su signed tipais dalinamos absoliučios reikšmės,
+	// o rezultatas suapvalinamas link nulio kaip ir su operatoriumi /. Daliklis negali būti 0.
+	template<std::integral T>
+		requires (sizeof(T) <= sizeof(uint64_t))
+	struct invariant_divisor {
+		// Member types
+		using value_type = T;
+		using unsigned_type = std::make_unsigned_t<value_type>;
+		using wide_type = next_unsigned_t<unsigned_type>;
+
+
+
+		// Observers
+		constexpr value_type divisor() const { return d; }
+
+
+
+		// Operations
+		constexpr value_type quotient(const value_type n) const {
+			if constexpr (std::unsigned_integral<value_type>) {
+				return unsigned_quotient(n);
+			} else {
+				const unsigned_type q = unsigned_quotient(magnitude(n));
+				return ((n < 0) != (d < 0)) ? sign(unsigned_type(unsigned_type{0} - q)) : sign(q);
+			}
+		}
+
+		constexpr value_type remainder(const value_type n) const {
+			return static_cast<value_type>(n - quotient(n) * d);
+		}
+
+		constexpr pair<value_type> divmod(const value_type n) const {
+			const value_type q = quotient(n);
+			return {q, static_cast<value_type>(n - q * d)};
+		}
+
+		// Elementai pakeičiami vietoje, kad ciklas galėtų būti vektorizuotas.
+		template<std_r::contiguous_range R>
+			requires (std::same_as<std_r::range_value_t<R>, value_type>)
+		constexpr void quotient(R && r) const {
+			for (value_type & x : r)
+				x = quotient(x);
+		}
+
+		template<std_r::contiguous_range R>
+			requires (std::same_as<std_r::range_value_t<R>, value_type>)
+		constexpr void remainder(R && r) const {
+			for (value_type & x : r)
+				x = remainder(x);
+		}
+
+
+
+		// Special member functions
+		constexpr invariant_divisor(const value_type x)
+			: d{x}
+		{
+			const unsigned_type a = magnitude(x);
+			const size_t l = unsign(std::bit_width(unsigned_type(a - 1)));
+
+			magic = static_cast<unsigned_type>(
+				((wide_type{1} << numeric_digits<unsigned_type>()) * ((wide_type{1} << l) - a)) / a + 1);
+			shift1 = std::min(l, 1uz);
+			shift2 = l - shift1;
+		}
+
+
+
+	protected:
+		static constexpr unsigned_type magnitude(const value_type x) {
+			if constexpr (std::unsigned_integral<value_type>)	return x;
+			else												return x < 0 ? unsigned_type(unsigned_type{0} - unsign(x)) : unsign(x);
+		}
+
+		constexpr unsigned_type unsigned_quotient(const unsigned_type n) const {
+			const unsigned_type t = static_cast<unsigned_type>((wide_type{magic} * n) >> numeric_digits<unsigned_type>());
+			return static_cast<unsigned_type>((t + static_cast<unsigned_type>((n - t) >> shift1)) >> shift2);
+		}
+
+
+
+		// Member objects
+		value_type d;
+		unsigned_type magic;
+		size_t shift1, shift2;
+	};
+
+}
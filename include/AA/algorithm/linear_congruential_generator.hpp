@@ -9,6 +9,27 @@
 
 namespace aa {
 
+	// https://www.nayuki.io/page/fast-skipping-in-a-linear-congruential-generator
+	// https://docs.rs/randomize/2.2.2/src/randomize/lcg.rs.html#99-114
+	// Atskirta nuo klasės, nes tą patį šuolį naudoja ir kiti generatoriai su lcg būsena.
+	template<std::unsigned_integral T, std::unsigned_integral U>
+	constexpr pair<T> linear_congruential_jump_coefficients(T cur_mult, T cur_plus, U n) {
+		T acc_mult = 1, acc_plus = 0;
+		do {
+			if (n & 1) {
+				acc_mult *= cur_mult;
+				(acc_plus *= cur_mult) += cur_plus;
+			}
+			if (n >>= 1) {
+				cur_plus *= cur_mult + 1;
+				cur_mult *= cur_mult;
+			} else break;
+		} while (true);
+		return {acc_mult, acc_plus};
+	}
+
+
+
 	// lcg būsenos nėra ordered, jos sudaro ciklą.
 	//
 	// requires paaiškinimas, kad prie visų SEED reikšmių, periodas būtų MODULUS reikia tinkamų parametrų.
@@ -61,7 +82,8 @@ namespace aa {
 		// Galima generuoti atsitiktinius skaičius bet kokiame intervale naudojant slankiojo kablelio skaičius,
 		// bet nors šališkumas metodo toks pat kaip ir dabar naudojamo metodo, jo greitaveika yra mažesnė.
 		// Greičiausias būdas kaip generuoti nešališkus atsitiktinius skaičius intervale: https://arxiv.org/abs/1805.10941.
-		// Naudojami metodai su šališkumu, nes mums svarbiausia greitaveika, o šališkumas nėra didelis.
+		// Pagal nutylėjimą naudojami metodai su šališkumu, nes mums svarbiausia greitaveika, o šališkumas nėra didelis.
+		// Kur šališkumas nepriimtinas, galima naudoti int_generate<true>, kuris realizuoja šį metodą.
 		result_type state;
 
 
@@ -74,23 +96,24 @@ namespace aa {
 
 		constexpr result_type operator()() { return next(); }
 
-		// https://www.nayuki.io/page/fast-skipping-in-a-linear-congruential-generator
-		// https://docs.rs/randomize/2.2.2/src/randomize/lcg.rs.html#99-114
+		// Grąžina daugiklį ir prieaugį, kuriais būsena pastumiama per n žingsnių vienu veiksmu.
 		template<std::unsigned_integral U>
-		constexpr result_type jump(U n) {
-			result_type acc_mult = 1, acc_plus = 0,
-				cur_mult = multiplier(), cur_plus = increment();
-			do {
-				if (n & 1) {
-					acc_mult *= cur_mult;
-					(acc_plus *= cur_mult) += cur_plus;
-				}
-				if (n >>= 1) {
-					cur_plus *= cur_mult + 1;
-					cur_mult *= cur_mult;
-				} else break;
-			} while (true);
-			return (state = (state * acc_mult) + acc_plus);
+		static constexpr pair<result_type> jump_coefficients(const U n) {
+			return linear_congruential_jump_coefficients<result_type>(multiplier(), increment(), n);
+		}
+
+		template<std::unsigned_integral U>
+		constexpr result_type jump(const U n) {
+			const pair<result_type> p = jump_coefficients(n);
+			return (state = (state * get_0(p)) + get_1(p));
+		}
+
+		// Grąžina i-tąjį iš count nepersidengiančių srautų, t.y. generatorių pastumtą per i * (modulus / count) žingsnių.
+		// Kiekvienai gijai galima duoti savo srautą, kurie nepersidengs, jei kiekviena gija sugeneruos ne daugiau nei modulus / count reikšmių.
+		constexpr linear_congruential_generator split(const size_t i, const size_t count) const {
+			linear_congruential_generator g = *this;
+			g.jump(static_cast<modulus_type>((modulus() / count) * i));
+			return g;
 		}
 
 		// https://math.stackexchange.com/questions/2008585/computing-the-distance-between-two-linear-congruential-generator-states
@@ -122,4 +145,79 @@ namespace aa {
 		}
 	};
 
+
+
+	// Juostos laiko sekančias N generatoriaus reikšmių, todėl užpildant masyvą visos juostos pastumiamos per N žingsnių
+	// vienu daugybos ir sudėties veiksmu, kurį kompiliatorius vektorizuoja. Reikšmių tvarka sutampa su generatoriaus.
+	// Jei užpildomų reikšmių skaičius nesidalina iš N, po likučio visos juostos pastumiamos per likutį.
+	template<size_t N = 8, class G = linear_congruential_generator<>>
+		requires (!!N)
+	struct interleaved_linear_congruential_generator {
+		// Member types
+		using generator_type = G;
+		using result_type = typename generator_type::result_type;
+
+
+
+		// Member constants
+		static consteval size_t lane_count() { return N; }
+
+
+
+		// Characteristics
+		static consteval result_type min() { return generator_type::min(); }
+		static consteval result_type max() { return generator_type::max(); }
+
+
+
+		// Generation
+		template<sized_contiguous_range R>
+			requires (std::same_as<std_r::range_value_t<R>, result_type>)
+		constexpr void generate(R && r) {
+			constexpr pair<result_type> STEP = generator_type::jump_coefficients(N);
+			result_type * const out = std_r::data(r);
+			const size_t count = std_r::size(r);
+			const size_t blocks = count - remainder<N>(count);
+
+			for (size_t i = 0; i != blocks; i += N) {
+#pragma GCC ivdep
+				for (size_t j = 0; j != N; ++j) {
+					out[i + j] = lanes[j];
+					lanes[j] = (lanes[j] * get_0(STEP)) + get_1(STEP);
+				}
+			}
+
+			if (const size_t rest = count - blocks) {
+				for (size_t j = 0; j != rest; ++j)
+					out[blocks + j] = lanes[j];
+
+				const pair<result_type> p = generator_type::jump_coefficients(rest);
+				for (result_type & lane : lanes)
+					lane = (lane * get_0(p)) + get_1(p);
+			}
+		}
+
+		// Grąžina generatorių, kurio next() grąžins tą pačią reikšmę kaip sekanti generate reikšmė.
+		constexpr generator_type generator() const {
+			generator_type g = {lanes[0]};
+			g.prev();
+			return g;
+		}
+
+
+
+		// Special member functions
+		constexpr interleaved_linear_congruential_generator() : interleaved_linear_congruential_generator{generator_type{}} {}
+
+		constexpr interleaved_linear_congruential_generator(generator_type g) {
+			for (result_type & lane : lanes)
+				lane = g.next();
+		}
+
+
+
+		// Member objects
+		std::array<result_type, N> lanes;
+	};
+
 }
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../metaprogramming/generator.hpp"
+#include "../container/fixed_vector.hpp"
+#include <thread>
+
+
+
+namespace aa {
+
+	// Masyvas padalinamas į thread_count dalių ir kiekviena gija gauna generatoriaus kopiją, pastumtą iki savo dalies
+	// pradžios, todėl rezultatas toks pat kaip užpildant nuosekliai ir nepriklauso nuo gijų skaičiaus.
+	// Pirma dalis užpildoma kviečiančioje gijoje. Po užpildymo g pastumiamas per užpildytų reikšmių skaičių.
+	//
+	// Nepavykus išskirti atminties gijoms, visos dalys užpildomos kviečiančioje gijoje.
+	template<jumpable_generator G, sized_contiguous_range R>
+		requires (std::same_as<std_r::range_value_t<R>, generator_result_t<G>>)
+	void parallel_generate(G & g, R && r, const size_t thread_count = std::thread::hardware_concurrency()) {
+		generator_result_t<G> * const data = std_r::data(r);
+		const size_t count = std_r::size(r);
+		if (!count)
+			return;
+
+		const size_t workers = std::max(thread_count, 1uz);
+		const size_t chunk = (count + workers - 1) / workers;
+
+		const auto fill = [&](const size_t begin) {
+			G worker = g;
+			worker.jump(begin);
+
+			const size_t end = std::min(begin + chunk, count);
+			for (size_t i = begin; i != end; ++i)
+				data[i] = worker();
+		};
+
+		{
+			// std::jthread destruktorius palaukia kol gija baigs darbą.
+			fixed_vector<std::jthread> threads = {workers};
+			for (size_t begin = chunk; begin < count; begin += chunk) {
+				if (threads.has_ownership())	threads.emplace_back(fill, begin);
+				else							fill(begin);
+			}
+			fill(0);
+		}
+		g.jump(count);
+	}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "arithmetic.hpp"
+#include "linear_congruential_generator.hpp"
+#include <chrono> // steady_clock
+
+
+
+namespace aa {
+
+	// https://www.pcg-random.org/pdf/hmc-cs-2014-0905.pdf
+	// PCG64 (XSL-RR 128/64): 128 bitų lcg būsena, o grąžinama 64 bitų reikšmė gaunama sujungus būsenos puses su xor
+	// ir pasukus per 6 vyriausius būsenos bitus. Kadangi būsena yra lcg, šuolis atliekamas taip pat kaip ir lcg.
+	//
+	// Generuojami 64 bitų skaičiai, todėl distribution_result_t yra uint128_t ir int_generate bei real_generate veikia be pakeitimų.
+	struct permuted_congruential_generator {
+		// Member types
+		using result_type = uint64_t;
+		using state_type = uint128_t;
+
+
+
+		// Member constants
+		static consteval state_type multiplier() { return (state_type{0x2360ED051FC65DA4} << 64) | 0x4385DF649FCCF645; }
+		static consteval state_type increment() { return (state_type{0x5851F42D4C957F2D} << 64) | 0x14057B7EF767814F; }
+
+
+
+		// Characteristics
+		static consteval result_type min() { return numeric_min; }
+		static consteval result_type max() { return numeric_max; }
+
+
+
+		// Special member functions
+		constexpr permuted_congruential_generator() { seed(); }
+		constexpr permuted_congruential_generator(const state_type s) { seed(s); }
+
+
+
+		// Member objects
+		state_type state;
+
+
+
+		// Generation
+		constexpr result_type next() {
+			state = (state * multiplier()) + increment();
+			return curr();
+		}
+
+		constexpr result_type curr() const {
+			return std::rotr(static_cast<result_type>(state >> 64) ^ static_cast<result_type>(state), static_cast<int>(state >> 122));
+		}
+
+		constexpr result_type operator()() { return next(); }
+
+		template<std::unsigned_integral U>
+		constexpr result_type jump(const U n) {
+			const pair<state_type> p = linear_congruential_jump_coefficients(multiplier(), increment(), n);
+			state = (state * get_0(p)) + get_1(p);
+			return curr();
+		}
+
+		// Kaip ir lcg, grąžina generatorių pastumtą per i * (2^128 / count) žingsnių.
+		constexpr permuted_congruential_generator split(const size_t i, const size_t count) const {
+			permuted_congruential_generator g = *this;
+			g.jump(((state_type{0} - 1) / count + 1) * i);
+			return g;
+		}
+
+		// Seeding
+		// Kaip pcg32_srandom_r, pradinė reikšmė pridedama po pirmo žingsnio, kad mažos pradinės reikšmės duotų skirtingas sekas.
+		constexpr void seed() {
+			seed(sign_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+		}
+
+		constexpr void seed(const state_type s) {
+			state = increment();
+			state = ((state + s) * multiplier()) + increment();
+		}
+	};
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "arithmetic.hpp"
+#include <chrono> // steady_clock
+
+
+
+namespace aa {
+
+	// https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+	// Philox4x32-10: i-toji reikšmė yra tik rakto ir i funkcija, todėl ją galima gauti iš karto, nekeičiant būsenos.
+	// Vienas blokas iš 10 raundų duoda 4 reikšmes, todėl nuosekliai generuojant paskutinis blokas laikomas, o naujas
+	// skaičiuojamas kas 4 reikšmes. Šuolis tik pakeičia indeksą.
+	//
+	// Indeksas yra 64 bitų reikšmės indeksas, o skaitiklio 2 ir 3 žodžiai visada 0, todėl su vienu raktu galima gauti 2^64 reikšmių.
+	struct philox_generator {
+		// Member types
+		using result_type = uint32_t;
+		using key_type = std::array<uint32_t, 2>;
+		using block_type = std::array<uint32_t, 4>;
+
+
+
+		// Member constants
+		static consteval size_t block_size() { return 4; }
+		static consteval size_t round_count() { return 10; }
+
+
+
+		// Characteristics
+		static consteval result_type min() { return numeric_min; }
+		static consteval result_type max() { return numeric_max; }
+
+
+
+		// Special member functions
+		constexpr philox_generator() { seed(); }
+		constexpr philox_generator(const uint64_t s) { seed(s); }
+
+
+
+		// Member objects
+		key_type key;
+		uint64_t index;
+		block_type block;
+
+
+
+		// Generation
+		static constexpr block_type block_at(key_type k, const uint64_t counter) {
+			block_type x = {static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), 0, 0};
+			for (size_t r = 0; r != round_count(); ++r) {
+				if (r) {
+					k[0] += 0x9E3779B9;
+					k[1] += 0xBB67AE85;
+				}
+				const uint64_t p0 = uint64_t{0xD2511F53} * x[0];
+				const uint64_t p1 = uint64_t{0xCD9E8D57} * x[2];
+				x = {
+					static_cast<uint32_t>(p1 >> 32) ^ x[1] ^ k[0], static_cast<uint32_t>(p1),
+					static_cast<uint32_t>(p0 >> 32) ^ x[3] ^ k[1], static_cast<uint32_t>(p0)};
+			}
+			return x;
+		}
+
+		constexpr result_type value_at(const uint64_t i) const {
+			return block_at(key, quotient<block_size()>(i))[remainder<block_size()>(i)];
+		}
+
+		constexpr result_type next() {
+			if (!remainder<block_size()>(index))
+				block = block_at(key, quotient<block_size()>(index));
+			return block[remainder<block_size()>(index++)];
+		}
+
+		constexpr result_type operator()() { return next(); }
+
+		template<std::unsigned_integral U>
+		constexpr void jump(const U n) {
+			index += n;
+			if (remainder<block_size()>(index))
+				block = block_at(key, quotient<block_size()>(index));
+		}
+
+		// out[k] = value_at(indexes[k]). Iteracijos nepriklauso viena nuo kitos, todėl ciklas vektorizuojamas.
+		template<sized_contiguous_range I, sized_contiguous_range O>
+			requires (std::unsigned_integral<std_r::range_value_t<I>> && std::same_as<std_r::range_value_t<O>, result_type>)
+		constexpr void generate_at(const I & indexes, O && out) const {
+			const std_r::range_value_t<I> * const in = std_r::data(indexes);
+			result_type * const data = std_r::data(out);
+			const size_t count = std_r::size(indexes);
+			for (size_t k = 0; k != count; ++k)
+				data[k] = value_at(in[k]);
+		}
+
+		// Seeding
+		constexpr void seed() {
+			seed(sign_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+		}
+
+		constexpr void seed(const uint64_t s) {
+			key = {static_cast<uint32_t>(s), static_cast<uint32_t>(s >> 32)};
+			index = 0;
+		}
+	};
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "arithmetic.hpp"
+#include "hash.hpp"
+#include <chrono> // steady_clock
+
+
+
+namespace aa {
+
+	// https://prng.di.unimi.it/xoshiro256plusplus.c
+	// xoshiro256++: 256 bitų būsena, kuri keičiama tik postūmiais, xor ir pasukimais, todėl generatorius greitesnis už lcg
+	// su 128 bitų daugyba. Būsena pradžioje užpildoma su splitmix64, nes ji negali būti visa nulinė.
+	//
+	// Skirtingai nei lcg, šuolis per bet kokį žingsnių skaičių būtų brangus, todėl turime tik fiksuotus šuolius
+	// per 2^128 ir 2^192 žingsnių, kurių užtenka nepersidengiantiems srautams gijoms sukurti.
+	struct xoshiro_generator {
+		// Member types
+		using result_type = uint64_t;
+		using state_type = std::array<uint64_t, 4>;
+
+
+
+		// Characteristics
+		static consteval result_type min() { return numeric_min; }
+		static consteval result_type max() { return numeric_max; }
+
+
+
+		// Special member functions
+		constexpr xoshiro_generator() { seed(); }
+		constexpr xoshiro_generator(const result_type s) { seed(s); }
+
+
+
+		// Member objects
+		state_type state;
+
+
+
+		// Generation
+		constexpr result_type next() {
+			const result_type result = std::rotl(state[0] + state[3], 23) + state[0];
+			const uint64_t t = state[1] << 17;
+
+			state[2] ^= state[0];
+			state[3] ^= state[1];
+			state[1] ^= state[2];
+			state[0] ^= state[3];
+			state[2] ^= t;
+			state[3] = std::rotl(state[3], 45);
+			return result;
+		}
+
+		constexpr result_type operator()() { return next(); }
+
+		// Atitinka 2^128 next() kvietimų.
+		constexpr void jump() {
+			apply_jump({0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C});
+		}
+
+		// Atitinka 2^192 next() kvietimų.
+		constexpr void long_jump() {
+			apply_jump({0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635});
+		}
+
+		// Seeding
+		constexpr void seed() {
+			seed(sign_cast<result_type>(std::chrono::steady_clock::now().time_since_epoch().count()));
+		}
+
+		constexpr void seed(result_type s) {
+			for (uint64_t & x : state)
+				x = detail::mix64(s += 0x9E3779B97F4A7C15);
+		}
+
+	protected:
+		constexpr void apply_jump(const state_type & polynomial) {
+			state_type s = {};
+			for (const uint64_t word : polynomial) {
+				for (size_t b = 0; b != 64; ++b) {
+					if (word & (uint64_t{1} << b)) {
+						for (size_t i = 0; i != 4; ++i)
+							s[i] ^= state[i];
+					}
+					next();
+				}
+			}
+			state = s;
+		}
+	};
+
+}
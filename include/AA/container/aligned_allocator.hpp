@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+
+
+
+namespace aa {
+
+	// Toks pat kaip nothrow_allocator, bet masyvai sulygiuojami pagal ALIGNMENT, pavyzdžiui podėlio eilutę ar vektorinį registrą.
+	// alignof(T) tikrinamas tik išskiriant atmintį, todėl tipą galima įvardinti ir su nepilnu T.
+	template<class T, size_t ALIGNMENT>
+		requires (std::has_single_bit(ALIGNMENT))
+	struct aligned_allocator {
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+
+
+
+		// Member constants
+		static consteval size_t alignment() { return std::max(ALIGNMENT, alignof(value_type)); }
+
+
+
+		// Member functions
+		// https://gcc.gnu.org/onlinedocs/libstdc++/manual/dynamic_memory.html
+		static constexpr pointer allocate(const size_type n) {
+			return std::bit_cast<pointer>(__builtin_operator_new(
+				product<sizeof(value_type)>(n), std::align_val_t{alignment()}, std::nothrow));
+		}
+
+		static constexpr void deallocate(const pointer p, const size_type n) {
+			__builtin_operator_delete(
+				p, product<sizeof(value_type)>(n), std::align_val_t{alignment()});
+		}
+
+		static constexpr void deallocate(const pointer p) {
+			__builtin_operator_delete(
+				p, std::align_val_t{alignment()});
+		}
+	};
+
+}
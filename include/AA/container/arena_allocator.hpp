@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+
+
+
+namespace aa {
+
+	// https://en.wikipedia.org/wiki/Region-based_memory_management
+	// Alokatoriai turi būti tušti, nes fixed_array ir default_deallocate juos konstruoja su c<ALLOC>(), todėl arenos būsena
+	// laikoma thread_local kintamajame. Taip kiekviena gija turi savo areną ir alokuojant nereikia sinchronizacijos.
+	// Skirtingus TAG naudojantys alokatoriai naudoja skirtingas arenas.
+	//
+	// Blokai išskiriami su nothrow operator new, o nepavykus išskirti atminties grąžinamas nullptr kaip ir nothrow_allocator.
+	template<size_t BLOCK_SIZE = int_exp2(20u), class TAG = void>
+		requires (BLOCK_SIZE > 0)
+	struct monotonic_arena {
+		// Member functions
+		static constexpr void * allocate(const size_t bytes, const size_t alignment) {
+			do {
+				const uintptr_t p = (std::bit_cast<uintptr_t>(state.cursor) + (alignment - 1)) & ~(alignment - 1);
+				if (state.head && p + bytes <= std::bit_cast<uintptr_t>(state.end)) {
+					state.cursor = std::bit_cast<std::byte *>(p + bytes);
+					return std::bit_cast<void *>(p);
+				}
+			} while (state.grow(bytes + alignment));
+			return nullptr;
+		}
+
+		// Paliekamas tik paskutinis išskirtas blokas, nes jis greičiausiai bus pakankamo dydžio ir sekančiai užklausai.
+		static constexpr void reset() {
+			state.release(false);
+		}
+
+
+
+		// Member objects
+	private:
+		struct block_header {
+			block_header * next;
+			size_t size;
+		};
+
+		struct state_type {
+			constexpr bool grow(const size_t bytes) {
+				const size_t size = std::max(BLOCK_SIZE, bytes + sizeof(block_header));
+				block_header * const block = std::bit_cast<block_header *>(__builtin_operator_new(size, std::nothrow));
+				if (!block)
+					return false;
+
+				head = std_r::construct_at(block, head, size);
+				cursor = std::bit_cast<std::byte *>(block + 1);
+				end = std::bit_cast<std::byte *>(block) + size;
+				return true;
+			}
+
+			constexpr void release(const bool all) {
+				if (!head)
+					return;
+
+				for (block_header * block = head->next; block;) {
+					block_header * const next = block->next;
+					__builtin_operator_delete(block, block->size);
+					block = next;
+				}
+				head->next = nullptr;
+				cursor = std::bit_cast<std::byte *>(head + 1);
+
+				if (all) {
+					__builtin_operator_delete(head, head->size);
+					head = nullptr;
+				}
+			}
+
+			constexpr ~state_type() {
+				release(true);
+			}
+
+			block_header * head = nullptr;
+			std::byte * cursor = nullptr;
+			std::byte * end = nullptr;
+		};
+
+		static inline thread_local state_type state;
+	};
+
+
+
+	// Atmintis grąžinama tik visa iš karto su reset, todėl deallocate nieko nedaro.
+	// Po reset visi šiuo alokatoriumi sukurti konteineriai turi būti jau sunaikinti.
+	template<class T, class ARENA = monotonic_arena<>>
+	struct arena_allocator {
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+		using arena_type = ARENA;
+
+
+
+		// Member functions
+		static constexpr pointer allocate(const size_type n) {
+			return std::bit_cast<pointer>(arena_type::allocate(product<sizeof(value_type)>(n), alignof(value_type)));
+		}
+
+		static constexpr void deallocate(const pointer, const size_type) {}
+
+		static constexpr void deallocate(const pointer) {}
+
+		static constexpr void reset() {
+			arena_type::reset();
+		}
+	};
+
+}
@@ -139,10 +139,12 @@ namespace aa {
 			: ptr_to_front{std::move(o.ptr_to_front)}, ptr_to_tail{std::exchange(o.ptr_to_tail, default_value)} {}
 
 		// Nenaudojame std::allocator, nes klasė neturi atminties išskyrimo funkcijų, kurios nemestų išimčių.
+		// Nepavykus išskirti atminties, elementai nekonstruojami ir has_ownership grąžina false.
 		constexpr fixed_array(const size_type size)
 			: fixed_array{std::allocator_arg, size}
 		{
-			std_r::uninitialized_default_construct(*this);
+			if (has_ownership())
+				std_r::uninitialized_default_construct(*this);
 		}
 
 		constexpr ~fixed_array() {
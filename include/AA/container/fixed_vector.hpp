@@ -33,7 +33,10 @@ namespace aa {
 		// Neturime insert metodų, nes vietoje jų be problemų galima emplace metodus naudoti.
 		// Modifiers
 		constexpr iterator clear() {
-			return ptr_to_back = std_r::destroy(std::views::reverse(*this)).base() - 1;
+			if constexpr (std::is_trivially_destructible_v<value_type>)
+				return ptr_to_back = this->mut_prev_front();
+			else
+				return ptr_to_back = std_r::destroy(std::views::reverse(*this)).base() - 1;
 		}
 
 #pragma region // modify one
@@ -59,8 +62,13 @@ namespace aa {
 		template<class... A>
 			requires (std::constructible_from<value_type, A...>)
 		constexpr iterator fast_emplace(const iterator pos, A &&... args) {
-			emplace_back(std::move(*pos));
-			*pos = value_type{std::forward<A>(args)...};
+			if constexpr (trivially_relocatable<value_type>) {
+				ptr_to_back = trivially_relocate(pos, pos + 1, this->mut_next_back()) - 1;
+				std_r::construct_at(pos, std::forward<A>(args)...);
+			} else {
+				emplace_back(std::move(*pos));
+				*pos = value_type{std::forward<A>(args)...};
+			}
 			return pos;
 		}
 #pragma endregion
@@ -107,9 +115,15 @@ namespace aa {
 		// 	return pos;
 		// }
 
+		// Jei elementai trivially_relocatable, pašalinti elementai sunaikinami, o likę perkeliami vienu memmove.
 		constexpr iterator pop(const iterator pos, const size_type count = 1) {
-			std_r::move(pos + count, this->next_back(), pos);
-			pop_back(count);
+			if constexpr (trivially_relocatable<value_type>) {
+				std_r::destroy(pos, pos + count);
+				ptr_to_back = trivially_relocate(pos + count, this->mut_next_back(), pos) - 1;
+			} else {
+				std_r::move(pos + count, this->next_back(), pos);
+				pop_back(count);
+			}
 			return pos;
 		}
 
@@ -121,9 +135,16 @@ namespace aa {
 #pragma endregion
 
 #pragma region // fast-modify many anywhere
+		// Jei po pašalintais elementais yra mažiau nei count elementų, perkeliami tik jie.
 		constexpr iterator fast_pop(const iterator pos, const size_type count = 1) {
-			std_r::move(this->mut_next_back() - count, this->next_back(), pos);
-			pop_back(count);
+			if constexpr (trivially_relocatable<value_type>) {
+				std_r::destroy(pos, pos + count);
+				trivially_relocate(std::max(pos + count, this->mut_next_back() - count), this->mut_next_back(), pos);
+				ptr_to_back -= count;
+			} else {
+				std_r::move(std::max(pos + count, this->mut_next_back() - count), this->mut_next_back(), pos);
+				pop_back(count);
+			}
 			return pos;
 		}
 
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+#include "../algorithm/hash.hpp"
+#include "fixed_array.hpp"
+
+
+
+namespace aa {
+
+	namespace detail {
+		// Reikšmė laikoma union'e, nes ar vieta užimta nusprendžiama tik pagal kontrolinį baitą.
+		template<class T>
+		struct flat_slot {
+			// Special member functions
+			constexpr flat_slot() {}
+
+			constexpr ~flat_slot() {}
+
+			// Member objects
+			union { T value; };
+		};
+
+		// GCC vektoriniai tipai kompiliuojami į SSE2 ar NEON instrukcijas, todėl nereikia atskirų realizacijų kiekvienai architektūrai.
+		// Kiekvieno baito vyriausias bitas surenkamas į vieną žodį daugyba, kaip tai daro pmovmskb.
+		struct control_group {
+			// Member types
+			using value_type = int8_t;
+			using vector_type = value_type __attribute__((vector_size(16)));
+			using mask_type = uint32_t;
+
+
+
+			// Member constants
+			static consteval size_t size() { return sizeof(vector_type); }
+
+
+
+			// Lookup
+			constexpr mask_type match(const value_type control) const {
+				return bitmask(value == control);
+			}
+
+			// Tušti baitai yra neigiami, o užimti ne, todėl užtenka vyriausių bitų.
+			constexpr mask_type match_empty() const {
+				return bitmask(value);
+			}
+
+
+
+			// Special member functions
+			constexpr control_group(const value_type * const p) {
+				__builtin_memcpy(&value, p, size());
+			}
+
+
+
+			// Member objects
+			vector_type value;
+
+		private:
+			static constexpr mask_type bitmask(const vector_type v) {
+				const std::array<uint64_t, 2> words = std::bit_cast<std::array<uint64_t, 2>>(v);
+				return gather(words[0]) | gather(words[1]) << 8;
+			}
+
+			static constexpr mask_type gather(const uint64_t word) {
+				return static_cast<mask_type>(((word & 0x8080808080808080) * 0x0002040810204081) >> 56);
+			}
+		};
+	}
+
+	// https://abseil.io/about/design/swisstables
+	// https://en.wikipedia.org/wiki/Linear_probing#Deletion
+	// Kiekviena vieta turi kontrolinį baitą: tuščia vieta pažymima empty_control(), o užimta 7 vyriausiais maišos bitais.
+	// Kontroliniai baitai tikrinami grupėmis po 16, o pirmi 15 baitų nukopijuojami masyvo gale, kad grupę būtų galima
+	// nuskaityti nuo bet kurios vietos. Vietos ieškoma tiesiniu bandymu, todėl šalinant elementai pastumiami atgal
+	// ir žymių (tombstones) nereikia.
+	//
+	// Talpa nustatoma konstruktoriuje, užpildymas ne didesnis nei 7/8. Pilname žemėlapyje ar žemėlapyje be atminties emplace grąžina nullptr.
+	// Su string_equal_to ir std::string raktais galima ieškoti pagal std::string_view nekonstruojant rakto.
+	template<class K, class V, class HASH = generic_hash<>, class EQUAL = std::equal_to<>>
+	struct flat_hash_map {
+		// Member types
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = pair<key_type, mapped_type>;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = value_type &;
+		using const_reference = const value_type &;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+		using hasher = HASH;
+		using key_equal = EQUAL;
+		using group_type = detail::control_group;
+		using control_type = group_type::value_type;
+		using slot_type = detail::flat_slot<value_type>;
+		using slots_type = fixed_array<slot_type, nothrow_allocator<slot_type>>;
+		using controls_type = fixed_array<control_type, nothrow_allocator<control_type>>;
+
+
+
+		// Member constants
+		static consteval control_type empty_control() { return numeric_min; }
+
+
+
+		// Lookup
+		// Žemėlapis be atminties (sukonstruotas be talpos, perkeltas ar nepavykus išskirti atminties) neturi vietų, todėl jų neieškoma.
+		template<class U>
+		constexpr pointer find(const U & key) {
+			if (!has_ownership())
+				return nullptr;
+
+			const pair<size_type, bool> p = probe(key, hash(key));
+			return get_element<1>(p) ? std::addressof(slots[get_element<0>(p)].value) : nullptr;
+		}
+
+		template<class U>
+		constexpr const_pointer find(const U & key) const {
+			return const_cast<flat_hash_map &>(*this).find(key);
+		}
+
+		template<class U>
+		constexpr bool contains(const U & key) const {
+			return has_ownership() && get_element<1>(probe(key, hash(key)));
+		}
+
+
+
+		// Capacity
+		constexpr bool empty() const { return !length; }
+		constexpr bool full() const { return length == capacity(); }
+
+		constexpr size_type size() const { return length; }
+		constexpr size_type capacity() const { return bucket_count() - quotient<8>(bucket_count()); }
+		constexpr size_type bucket_count() const { return slots.size(); }
+
+		constexpr bool has_ownership() const {
+			return slots.has_ownership() && controls.has_ownership();
+		}
+
+
+
+		// Modifiers
+		// Jei raktas jau yra, reikšmė nekonstruojama ir grąžinamas esamas elementas.
+		template<class U, class... A>
+			requires (std::constructible_from<key_type, U> && std::constructible_from<mapped_type, A...>)
+		constexpr pair<pointer, bool> emplace(U && key, A &&... args) {
+			if (!has_ownership())
+				return {nullptr, false};
+
+			const size_t h = hash(key);
+			const pair<size_type, bool> p = probe(key, h);
+			const size_type i = get_element<0>(p);
+
+			if (get_element<1>(p))
+				return {std::addressof(slots[i].value), false};
+			if (full())
+				return {nullptr, false};
+
+			std_r::construct_at(std::addressof(slots[i].value), std::forward<U>(key), mapped_type(std::forward<A>(args)...));
+			set_control(i, control(h));
+			++length;
+			return {std::addressof(slots[i].value), true};
+		}
+
+		// Po pašalinto elemento einantys elementai pastumiami atgal, jei jų namų vieta nėra tarp skylės ir jų pačių.
+		template<class U>
+		constexpr bool erase(const U & key) {
+			if (!has_ownership())
+				return false;
+
+			const pair<size_type, bool> p = probe(key, hash(key));
+			if (!get_element<1>(p))
+				return false;
+
+			size_type hole = get_element<0>(p);
+			std_r::destroy_at(std::addressof(slots[hole].value));
+
+			for (size_type i = next_index(hole); controls[i] != empty_control(); i = next_index(i)) {
+				const size_type home = hash(get_element<0>(slots[i].value)) & mask();
+				if (((i - home) & mask()) < ((i - hole) & mask()))
+					continue;
+
+				std_r::construct_at(std::addressof(slots[hole].value), std::move(slots[i].value));
+				std_r::destroy_at(std::addressof(slots[i].value));
+				set_control(hole, controls[i]);
+				hole = i;
+			}
+
+			set_control(hole, empty_control());
+			--length;
+			return true;
+		}
+
+		constexpr void clear() {
+			if constexpr (!std::is_trivially_destructible_v<value_type>) {
+				for (size_type i = 0; i != bucket_count(); ++i) {
+					if (controls[i] != empty_control())
+						std_r::destroy_at(std::addressof(slots[i].value));
+				}
+			}
+			std_r::fill(controls, empty_control());
+			length = 0;
+		}
+
+		constexpr flat_hash_map & operator=(flat_hash_map && o) & {
+			std_r::destroy_at(this);
+			return *std_r::construct_at(this, std::move(o));
+		}
+
+
+
+		// Special member functions
+		constexpr flat_hash_map()
+			: slots{}, controls{}, length{0} {}
+
+		constexpr flat_hash_map(flat_hash_map && o)
+			: slots{std::move(o.slots)}, controls{std::move(o.controls)}, length{std::exchange(o.length, 0)} {}
+
+		// Vietų skaičius yra dvejeto laipsnis, kad indeksą būtų galima gauti su kauke.
+		constexpr flat_hash_map(const size_type count)
+			: slots{std::bit_ceil(std::max(count + quotient<7>(count) + 1, group_type::size()))},
+			controls{slots.size() + (group_type::size() - 1)}, length{0}
+		{
+			if (has_ownership())
+				std_r::fill(controls, empty_control());
+		}
+
+		constexpr ~flat_hash_map() {
+			if (has_ownership())
+				clear();
+		}
+
+
+
+	protected:
+		// std::hash sveikiesiems skaičiams ir rodyklėms grąžina patį skaičių, todėl maiša sumaišoma su mix64. Vien daugybos
+		// neužtektų, nes jauniausi sandaugos bitai priklauso tik nuo jauniausių maišos bitų, o iš jų gaunama namų vieta.
+		template<class U>
+		static constexpr size_t hash(const U & key) {
+			return detail::mix64(c<hasher>()(key));
+		}
+
+		static constexpr control_type control(const size_t h) {
+			return static_cast<control_type>(h >> (numeric_digits<size_t>() - 7));
+		}
+
+		constexpr size_type mask() const { return bucket_count() - 1; }
+
+		constexpr size_type next_index(const size_type i) const { return (i + 1) & mask(); }
+
+		constexpr void set_control(const size_type i, const control_type value) {
+			controls[i] = value;
+			if (i < group_type::size() - 1)
+				controls[bucket_count() + i] = value;
+		}
+
+		// Jei raktas nerastas, grąžinama pirma tuščia vieta, į kurią raktą galima įdėti.
+		template<class U>
+		constexpr pair<size_type, bool> probe(const U & key, const size_t h) const {
+			for (size_type pos = h & mask();; pos = (pos + group_type::size()) & mask()) {
+				const group_type group = {controls.data() + pos};
+
+				for (group_type::mask_type m = group.match(control(h)); m; m &= m - 1) {
+					const size_type i = (pos + unsign(std::countr_zero(m))) & mask();
+					if (c<key_equal>()(get_element<0>(slots[i].value), key))
+						return {i, true};
+				}
+
+				if (const group_type::mask_type m = group.match_empty())
+					return {(pos + unsign(std::countr_zero(m))) & mask(), false};
+			}
+		}
+
+
+
+		// Member objects
+		slots_type slots;
+		controls_type controls;
+		size_type length;
+	};
+
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+#include "fixed_vector.hpp"
+
+
+
+namespace aa {
+
+	// https://en.wikipedia.org/wiki/Dynamic_array#Geometric_expansion_and_amortized_cost
+	// Kai vektorius pilnas, talpa padvigubinama. Jei elementai trivially_relocatable ir alokatorius turi reallocate metodą
+	// (pavyzdžiui mmap_allocator, kuris naudoja mremap), atmintis perkeliama nekopijuojant elementų.
+	// Kitu atveju išskiriama nauja atmintis ir elementai į ją perkeliami.
+	//
+	// Nepavykus išskirti atminties augant, programa baigiama, nes vektorius nebegalėtų įvykdyti savo kontrakto.
+	// Jei norima nepavykimą apdoroti, galima iš anksto kviesti reserve, kuris tokiu atveju grąžina false.
+	template<not_cref T, class_like ALLOC = nothrow_allocator<T>>
+	struct growable_vector : fixed_vector<T, ALLOC> {
+		// Member types
+		using base_type = fixed_vector<T, ALLOC>;
+		using typename base_type::value_type, typename base_type::size_type, typename base_type::difference_type,
+			typename base_type::reference, typename base_type::const_reference,
+			typename base_type::pointer, typename base_type::const_pointer,
+			typename base_type::iterator, typename base_type::const_iterator,
+			typename base_type::allocator_type;
+
+
+
+		// Capacity
+		// Nepavykus išskirti atminties, vektorius lieka nepakeistas.
+		constexpr bool reserve(const size_type n) {
+			if (!this->has_ownership())
+				return (*this = growable_vector{n}).has_ownership();
+
+			if (n <= this->capacity())
+				return true;
+
+			const size_type size = this->size();
+			const pointer old = this->ptr_to_front.get();
+			pointer p;
+
+			if constexpr (trivially_relocatable<value_type> && reallocate_exists<allocator_type>) {
+				p = c<allocator_type>().reallocate(old, this->capacity(), n);
+				if (!p)
+					return false;
+
+				std::move(this->ptr_to_front).release();
+				this->ptr_to_front.reset(p);
+			} else {
+				p = c<allocator_type>().allocate(n);
+				if (!p)
+					return false;
+
+				if constexpr (trivially_relocatable<value_type>) {
+					trivially_relocate(old, old + size, p);
+				} else {
+					std_r::uninitialized_move(old, old + size, p, p + size);
+					std_r::destroy(old, old + size);
+				}
+				this->ptr_to_front.reset(p, this->capacity());
+			}
+
+			this->ptr_to_tail = (p - 1) + n;
+			this->ptr_to_back = (p - 1) + size;
+			return true;
+		}
+
+		// Nieko nedaro, jei vektoriui atmintis dar neišskirta.
+		constexpr bool shrink_to_fit() {
+			if (!this->has_ownership() || this->full())
+				return true;
+
+			growable_vector v = {this->size()};
+			if (!v.has_ownership())
+				return false;
+
+			v.emplace_back_range(std::views::as_rvalue(*this));
+			return (*this = std::move(v), true);
+		}
+
+
+
+		// Modifiers
+		// Argumentai gali rodyti į šio vektoriaus elementus (pvz. v.emplace_back(v.back())), todėl prieš augant
+		// elementas sukonstruojamas, o į naują atmintį jis tik perkeliamas.
+		template<class... A>
+			requires (std::constructible_from<value_type, A...>)
+		constexpr iterator emplace_back(A &&... args) {
+			if (has_space(1))
+				return base_type::emplace_back(std::forward<A>(args)...);
+
+			value_type value(std::forward<A>(args)...);
+			ensure_space(1);
+			return base_type::emplace_back(std::move(value));
+		}
+
+		template<class... A>
+			requires (std::constructible_from<value_type, A...>)
+		constexpr iterator fast_emplace(const iterator pos, A &&... args) {
+			if (has_space(1))
+				return base_type::fast_emplace(pos, std::forward<A>(args)...);
+
+			const difference_type index = pos - this->data();
+			value_type value(std::forward<A>(args)...);
+			ensure_space(1);
+			return base_type::fast_emplace(this->data() + index, std::move(value));
+		}
+
+		constexpr iterator push_back(const size_type count = 1) {
+			ensure_space(count);
+			return base_type::template push_back<false>(count);
+		}
+
+		// Jei dydis nežinomas, elementai pridedami po vieną.
+		// Jei ištisinis r rodo į šio vektoriaus elementus, prieš augant jis nukopijuojamas. Kiti r negali priklausyti
+		// nuo šio vektoriaus elementų, nes augant jie būtų skaitomi iš atlaisvintos atminties.
+		template<std_r::input_range R>
+		constexpr iterator emplace_back_range(R && r) {
+			if constexpr (std_r::sized_range<R>) {
+				const size_type count = unsign(std_r::distance(r));
+
+				if constexpr (std_r::contiguous_range<R> && std::same_as<std_r::range_value_t<R>, value_type>) {
+					if (!has_space(count) && points_into(std_r::data(r))) {
+						growable_vector copy = {count};
+						copy.emplace_back_range(r);
+						return emplace_back_range(std::views::as_rvalue(copy));
+					}
+				}
+
+				ensure_space(count);
+				return base_type::template emplace_back_range<false>(r);
+			} else {
+				for (std_r::iterator_t<R> i = std_r::begin(r); i != std_r::end(r); ++i)
+					emplace_back(*i);
+				return this->ptr_to_back;
+			}
+		}
+
+		constexpr growable_vector & operator=(growable_vector && a) & {
+			std_r::destroy_at(this);
+			return *std_r::construct_at(this, std::move(a));
+		}
+
+	protected:
+		constexpr bool points_into(const const_pointer p) const {
+			return this->has_ownership() && !std::less<>{}(p, this->data()) && std::less<>{}(p, this->next_back());
+		}
+
+		constexpr bool has_space(const size_type count) const {
+			return this->has_ownership() && this->space() >= count;
+		}
+
+		constexpr void ensure_space(const size_type count) {
+			if (has_space(count))
+				return;
+
+			const size_type n = this->has_ownership()
+				? std::max(twice(this->capacity()), this->size() + count)
+				: count;
+
+			if (!reserve(n))
+				std::exit(EXIT_FAILURE);
+		}
+
+
+
+		// Special member functions
+	public:
+		using base_type::base_type;
+
+		constexpr growable_vector() = default;
+
+		constexpr growable_vector(growable_vector &&) = default;
+	};
+
+}
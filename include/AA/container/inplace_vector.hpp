@@ -0,0 +1,212 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+
+
+
+namespace aa {
+
+	// https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2024/p0843r14.html
+	// Elementai laikomi pačiame objekte, todėl atmintis neišskiriama ir prieinant prie elementų nereikia sekti rodyklės.
+	// Laikome elementų skaičių, o ne rodyklę į paskutinį elementą kaip fixed_vector, nes perkėlus objektą tokia rodyklė rodytų į seną objektą.
+	// Metodai pavadinti ir veikia taip pat kaip fixed_array ir fixed_vector metodai, kad konteinerius būtų galima lengvai sukeisti.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpadded"
+	template<not_cref T, size_t N>
+		requires (!!N)
+	struct inplace_vector {
+#pragma GCC diagnostic pop
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = value_type &;
+		using const_reference = const value_type &;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+		using iterator = pointer;
+		using const_iterator = const_pointer;
+
+
+
+		// Element access
+		template<class S>
+		constexpr auto && operator[](this S && self, const size_type pos) {
+			return std::forward_like<S>(self.elements[pos]);
+		}
+
+		template<bool CHECKED = true>
+		constexpr auto prev_front(this const auto & self) {
+			if constexpr (!CHECKED) return negative_infinity; else return		self.data() - 1;
+		}
+
+		constexpr auto data(this auto && self) { return				std_r::data(self.elements); }
+		constexpr auto begin(this auto && self) { return			std_r::data(self.elements); }
+
+		constexpr auto data_back(this auto && self) { return		self.data() + (self.length - 1); }
+
+		constexpr const_pointer next_back(this const auto & self) { return		self.data() + self.length; }
+		constexpr const_pointer end(this const auto & self) { return			self.data() + self.length; }
+
+		constexpr auto data_tail(this auto && self) { return		self.data() + (N - 1); }
+
+		template<bool CHECKED = true>
+		constexpr auto next_tail(this const auto & self) {
+			if constexpr (!CHECKED) return positive_infinity; else return		self.data() + N;
+		}
+
+	protected:
+		constexpr pointer mut_prev_front(this auto & self) { return				self.data() - 1; }
+		constexpr pointer mut_next_back(this auto & self) { return				self.data() + self.length; }
+		constexpr pointer mut_next_tail(this auto & self) { return				self.data() + N; }
+
+	public:
+		template<class S>
+		constexpr auto && front(this S && self) {
+			return std::forward_like<S>(self.elements[0]);
+		}
+
+		template<class S>
+		constexpr auto && back(this S && self) {
+			return std::forward_like<S>(self.elements[self.length - 1]);
+		}
+
+		template<class S>
+		constexpr auto && tail(this S && self) {
+			return std::forward_like<S>(self.elements[N - 1]);
+		}
+
+
+
+		// Capacity
+		constexpr bool empty() const { return !length; }
+		constexpr bool single() const { return length == 1; }
+		constexpr bool full() const { return length == N; }
+
+		constexpr size_type size() const { return length; }
+		constexpr size_type back_index() const { return length - 1; }
+
+		static consteval size_type capacity() { return N; }
+		static consteval size_type tail_index() { return N - 1; }
+
+		// capacity - size
+		constexpr size_type space() const { return N - length; }
+
+		static consteval size_type max_size() { return N; }
+		static consteval size_type min_size() { return numeric_min; }
+
+
+
+		// Modifiers
+	protected:
+		constexpr iterator set_next_back(const pointer next) {
+			length = unsign(next - data());
+			return next - 1;
+		}
+
+	public:
+		constexpr iterator clear() {
+			return set_next_back(std_r::destroy(std::views::reverse(*this)).base());
+		}
+
+#pragma region // modify one
+		template<class... A>
+			requires (std::constructible_from<value_type, A...>)
+		constexpr iterator emplace_back(A &&... args) {
+			const iterator i = std_r::construct_at(mut_next_back(), std::forward<A>(args)...);
+			++length;
+			return i;
+		}
+
+		template<class... A>
+			requires (std::constructible_from<value_type, A...>)
+		constexpr iterator fast_emplace(const iterator pos, A &&... args) {
+			emplace_back(std::move(*pos));
+			*pos = value_type{std::forward<A>(args)...};
+			return pos;
+		}
+#pragma endregion
+
+#pragma region // modify many back
+		template<bool CHECKED = true>
+		constexpr iterator pop_back(const size_type count = 1) {
+			return set_next_back(std_r::destroy(std::reverse_iterator{mut_next_back()}, std::reverse_iterator{
+				get_prev(next_back(), sign(count), prev_front<CHECKED>())}).base());
+		}
+
+		template<bool CHECKED = true>
+		constexpr iterator push_back(const size_type count = 1) {
+			return set_next_back(std_r::uninitialized_default_construct(mut_next_back(),
+				get_next(next_back(), sign(count), next_tail<CHECKED>())));
+		}
+
+		template<bool CHECKED = true, std_r::input_range R>
+		constexpr iterator emplace_back_range(R && r) {
+			return set_next_back(std_r::uninitialized_copy(r,
+				std_r::subrange{mut_next_back(), next_tail<CHECKED>()}).out);
+		}
+#pragma endregion
+
+#pragma region // modify many anywhere
+		constexpr iterator pop(const iterator pos, const size_type count = 1) {
+			std_r::move(pos + count, next_back(), pos);
+			pop_back(count);
+			return pos;
+		}
+#pragma endregion
+
+#pragma region // fast-modify many anywhere
+		// Jei po pašalintais elementais yra mažiau nei count elementų, perkeliami tik jie.
+		constexpr iterator fast_pop(const iterator pos, const size_type count = 1) {
+			std_r::move(std::max(pos + count, mut_next_back() - count), mut_next_back(), pos);
+			pop_back(count);
+			return pos;
+		}
+#pragma endregion
+
+		// Su trivially_copyable elementais specialūs metodai yra trivial, kad toks pats būtų ir konteineris.
+		constexpr inplace_vector & operator=(inplace_vector &&) & requires (trivially_copyable<value_type>) = default;
+
+		constexpr inplace_vector & operator=(inplace_vector && o) & {
+			std_r::destroy_at(this);
+			return *std_r::construct_at(this, std::move(o));
+		}
+
+
+
+		// Special member functions
+		// Elementai nekonstruojami, nes jie yra union'e, todėl konstruktorius nėra trivial.
+		constexpr inplace_vector() : length{0} {}
+
+		constexpr inplace_vector(inplace_vector &&) requires (trivially_copyable<value_type>) = default;
+
+		// Perkeliami tik elementai, o ne visas masyvas, nes likusi masyvo dalis nėra sukonstruota.
+		constexpr inplace_vector(inplace_vector && o) : length{0} {
+			emplace_back_range<false>(std::views::as_rvalue(o));
+		}
+
+		template<bool CHECKED = true>
+		constexpr inplace_vector(const size_type count, constant<CHECKED> = default_value) : inplace_vector{} {
+			push_back<CHECKED>(count);
+		}
+
+		template<bool CHECKED = true, std_r::input_range R>
+		constexpr inplace_vector(R && r, constant<CHECKED> = default_value) : inplace_vector{} {
+			emplace_back_range<CHECKED>(r);
+		}
+
+		constexpr ~inplace_vector() requires (std::is_trivially_destructible_v<value_type>) = default;
+
+		constexpr ~inplace_vector() {
+			std_r::destroy(*this);
+		}
+
+
+
+		// Member objects
+	protected:
+		size_type length;
+		union { value_type elements[N]; };
+	};
+
+}
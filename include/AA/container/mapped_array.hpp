@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+#include "managed.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+
+namespace aa {
+
+	// https://man7.org/linux/man-pages/man2/mmap.2.html
+	// Failas ne nuskaitomas į atmintį, o atvaizduojamas, todėl puslapiai įkeliami tik juos pirmą kartą paskaičius
+	// ir atmintyje failas nelaikomas du kartus. T turi būti trivially_copyable, nes failo baitai tiesiog interpretuojami kaip T masyvas.
+	//
+	// Elementų prieiga ir talpos metodai tokie patys kaip fixed_array, todėl algoritmai veikia nepakeisti. Masyvas tik skaitomas.
+	// Nepavykus atidaryti ar atvaizduoti failo, objektas lieka tuščias ir has_ownership grąžina false.
+	template<trivially_copyable T>
+	struct mapped_array {
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = const value_type &;
+		using const_reference = const value_type &;
+		using pointer = const value_type *;
+		using const_pointer = const value_type *;
+		using iterator = const_pointer;
+		using const_iterator = const_pointer;
+		using span_type = std::span<const value_type>;
+		using bytes_type = std::span<const std::byte>;
+
+		using descriptor_type = managed<t<[](const int fd) static { ::close(fd); }>, int, -1>;
+
+		// Laikomas visas atvaizduotas baitų skaičius, nes failo dydis nebūtinai dalijasi iš sizeof(T), o munmap reikia to paties ilgio kaip mmap.
+		using mapping_type = managed<
+			t<[](const bytes_type s) static { ::munmap(std::bit_cast<void *>(s.data()), s.size()); }>,
+			bytes_type, default_value,
+			t<[](const bytes_type s) static { return s.empty(); }>>;
+
+
+
+		// Element access
+		constexpr const_reference operator[](const size_type pos) const { return data()[pos]; }
+
+		constexpr const_pointer data() const { return std::bit_cast<const_pointer>(mapping.get().data()); }
+		constexpr const_pointer begin() const { return data(); }
+
+		constexpr const_pointer data_back() const { return data() + back_index(); }
+
+		constexpr const_pointer next_back() const { return data() + size(); }
+		constexpr const_pointer end() const { return data() + size(); }
+
+		constexpr const_reference front() const { return *data(); }
+		constexpr const_reference back() const { return *data_back(); }
+
+		constexpr span_type view() const { return {data(), size()}; }
+
+
+
+		// Capacity
+		constexpr bool empty() const { return !size(); }
+		constexpr bool single() const { return size() == 1; }
+
+		constexpr size_type size() const { return quotient<sizeof(value_type)>(mapping.get().size()); }
+		constexpr size_type back_index() const { return size() - 1; }
+
+		constexpr bool has_ownership() const {
+			return mapping.has_ownership();
+		}
+
+
+
+		// Special member functions
+		// Failo aprašas uždaromas tik sunaikinus objektą, o atvaizdavimas panaikinamas prieš tai, nes nariai naikinami atvirkštine tvarka.
+		constexpr mapped_array() = default;
+
+		constexpr mapped_array(const char * const path)
+			: descriptor{::open(path, O_RDONLY | O_CLOEXEC)}
+		{
+			if (!descriptor.has_ownership())
+				return;
+
+			struct ::stat status;
+			if (::fstat(descriptor.get(), &status) || status.st_size < sign(sizeof(value_type)))
+				return;
+
+			const size_t bytes = unsign(status.st_size);
+			void * const p = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descriptor.get(), 0);
+			if (p == MAP_FAILED)
+				return;
+
+			mapping.reset(bytes_type{std::bit_cast<const std::byte *>(p), bytes});
+		}
+
+
+
+		// Member objects
+	protected:
+		descriptor_type descriptor;
+		mapping_type mapping;
+	};
+
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+#include "nothrow_allocator.hpp"
+#include <sys/mman.h>
+
+
+
+namespace aa {
+
+	// https://www.kernel.org/doc/html/latest/admin-guide/mm/transhuge.html
+	// Dideli masyvai išskiriami su mmap ir pažymimi MADV_HUGEPAGE, kad atsitiktinė prieiga nesukeltų tiek daug TLB praleidimų.
+	// Mažesni už THRESHOLD baitų masyvai išskiriami su nothrow_allocator, nes jiems dideli puslapiai tik eikvotų atmintį.
+	//
+	// Jei POPULATE, puslapiai sukuriami iš karto su MADV_POPULATE_WRITE. Nenaudojame MAP_POPULATE, nes tada
+	// puslapiai būtų sukurti dar prieš MADV_HUGEPAGE ir madvise režime jie būtų įprasto dydžio.
+	//
+	// Neturime deallocate(p) metodo, nes be dydžio neišeitų nustatyti ar atmintis buvo išskirta su mmap.
+	template<class T, size_t THRESHOLD = int_exp2(21u), bool POPULATE = false>
+		requires (alignof(T) <= int_exp2(12u))
+	struct mmap_allocator {
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+		using fallback_type = nothrow_allocator<value_type>;
+
+
+
+		// Member constants
+		static consteval size_t huge_page_size() { return int_exp2(21u); }
+		static consteval size_t threshold() { return THRESHOLD; }
+
+		static constexpr bool is_mapped(const size_type n) {
+			return product<sizeof(value_type)>(n) >= threshold();
+		}
+
+		// Dydis suapvalinamas iki didelio puslapio dydžio kartotinio, o pradžia sulygiuojama map_aligned, todėl visi puslapiai gali būti dideli.
+		static constexpr size_t mapping_size(const size_type n) {
+			return (product<sizeof(value_type)>(n) + c(huge_page_size() - 1)) & c(~(huge_page_size() - 1));
+		}
+
+
+
+		// Member functions
+		static constexpr pointer allocate(const size_type n) {
+			if (!is_mapped(n))
+				return fallback_type::allocate(n);
+
+			const size_t size = mapping_size(n);
+			void * const p = map_aligned(size);
+			if (!p)
+				return nullptr;
+
+			::madvise(p, size, MADV_HUGEPAGE);
+			if constexpr (POPULATE)
+				::madvise(p, size, MADV_POPULATE_WRITE);
+			return std::bit_cast<pointer>(p);
+		}
+
+		static constexpr void deallocate(const pointer p, const size_type n) {
+			if (!is_mapped(n))
+				return fallback_type::deallocate(p, n);
+
+			::munmap(p, mapping_size(n));
+		}
+
+		// Galima naudoti tik trivially_relocatable elementams, nes atmintis perkeliama nekviečiant elementų konstruktorių.
+		// Kai abu dydžiai atvaizduojami, puslapiai perkeliami su mremap ir atmintis nekopijuojama.
+		// Pirma bandoma pakeisti dydį vietoje. Jei nepavyksta, MREMAP_MAYMOVE naujos vietos nesulygiuotų, todėl
+		// sulygiuota vieta rezervuojama su map_aligned ir puslapiai į ją perkeliami su MREMAP_FIXED.
+		// Nepavykus grąžinamas nullptr ir sena atmintis lieka nepakeista.
+		static constexpr pointer reallocate(const pointer p, const size_type n, const size_type m) {
+			if (is_mapped(n) && is_mapped(m)) {
+				const size_t old_size = mapping_size(n), new_size = mapping_size(m);
+				void * q = ::mremap(p, old_size, new_size, 0);
+
+				if (q == MAP_FAILED) {
+					void * const target = map_aligned(new_size);
+					if (!target)
+						return nullptr;
+
+					q = ::mremap(p, old_size, new_size, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+					if (q == MAP_FAILED) {
+						::munmap(target, new_size);
+						return nullptr;
+					}
+				}
+
+				::madvise(q, new_size, MADV_HUGEPAGE);
+				return std::bit_cast<pointer>(q);
+			}
+
+			const pointer q = allocate(m);
+			if (q) {
+				__builtin_memcpy(q, p, product<sizeof(value_type)>(std::min(n, m)));
+				deallocate(p, n);
+			}
+			return q;
+		}
+
+
+
+	protected:
+		// mmap grąžina tik įprasto puslapio dydžiu sulygiuotą adresą, o didelis puslapis gali būti tik huge_page_size() sulygiuotoje vietoje.
+		// Todėl atvaizduojama huge_page_size() baitų daugiau ir nesulygiuotos pradžios bei pabaigos dalys atlaisvinamos.
+		static constexpr void * map_aligned(const size_t size) {
+			void * const p = ::mmap(nullptr, size + huge_page_size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				return nullptr;
+
+			const uintptr_t start = std::bit_cast<uintptr_t>(p);
+			const uintptr_t aligned = (start + c(huge_page_size() - 1)) & c(~(huge_page_size() - 1));
+			const size_t head = aligned - start;
+
+			if (head)
+				::munmap(p, head);
+			::munmap(std::bit_cast<void *>(aligned + size), huge_page_size() - head);
+			return std::bit_cast<void *>(aligned);
+		}
+	};
+
+}
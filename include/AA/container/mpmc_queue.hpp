@@ -0,0 +1,154 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+#include "fixed_array.hpp"
+#include <atomic>
+#include <expected>
+#include <system_error>
+
+
+
+namespace aa {
+
+	namespace detail {
+		// Reikšmė laikoma union'e, nes ji konstruojama tik tada kai gamintojas užima vietą.
+		// Ar vieta užimta nusprendžiama tik pagal sequence, todėl destruktorius nieko nedaro.
+		template<class T>
+		struct mpmc_slot {
+			// Special member functions
+			constexpr mpmc_slot() : sequence{0} {}
+
+			constexpr ~mpmc_slot() {}
+
+			// Member objects
+			std::atomic<size_t> sequence;
+			union { T value; };
+		};
+	}
+
+	// https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+	// Kiekviena vieta turi savo sekos numerį, kuris nurodo kuriam gamintojo ar vartotojo ratui vieta paruošta.
+	// Kaip ir spsc_ring_buffer, indeksai tik didinami, todėl N turi būti dvejeto laipsnis.
+	//
+	// Vietos išskiriamos vieną kartą konstruktoriuje per nothrow_allocator, po to atmintis nebeišskiriama.
+	// Nepavykus išskirti atminties, has_ownership grąžina false ir eilės naudoti negalima.
+	// Nepavykus įdėti ar išimti grąžinamas std::expected ar std::optional, kad galima būtų naudoti AA_OR_RETURN ir panašius macros.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpadded"
+	template<std::movable T, size_t N>
+		requires (std::has_single_bit(N))
+	struct mpmc_queue {
+#pragma GCC diagnostic pop
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = value_type &;
+		using const_reference = const value_type &;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+		using slot_type = detail::mpmc_slot<value_type>;
+		using array_type = fixed_array<slot_type, nothrow_allocator<slot_type>>;
+		using error_type = std::errc;
+
+
+
+		// Capacity
+		// Kai kitos gijos keičia eilę, gaunama reikšmė gali būti jau pasenusi.
+		constexpr size_type size() const {
+			const size_type h = dequeue_pos.load(std::memory_order_acquire);
+			return min(enqueue_pos.load(std::memory_order_acquire) - h, capacity());
+		}
+
+		constexpr bool empty() const { return !size(); }
+		constexpr bool full() const { return size() == capacity(); }
+
+		static consteval size_type capacity() { return N; }
+
+		constexpr bool has_ownership() const {
+			return slots.has_ownership();
+		}
+
+
+
+		// Modifiers
+		template<class... A>
+			requires (std::constructible_from<value_type, A...>)
+		constexpr std::expected<void, error_type> try_emplace(A &&... args) {
+			size_type pos = enqueue_pos.load(std::memory_order_relaxed);
+			do {
+				slot_type & slot = slots[remainder<N>(pos)];
+				const difference_type diff = sign(slot.sequence.load(std::memory_order_acquire) - pos);
+
+				/*  */ if (!diff) {
+					if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						std_r::construct_at(std::addressof(slot.value), std::forward<A>(args)...);
+						slot.sequence.store(pos + 1, std::memory_order_release);
+						return std::expected<void, error_type>{std::in_place};
+					}
+
+				} else if (diff < 0) {
+					return std::expected<void, error_type>{std::unexpect, std::errc::resource_unavailable_try_again};
+
+				} else {
+					pos = enqueue_pos.load(std::memory_order_relaxed);
+				}
+			} while (true);
+		}
+
+		constexpr std::optional<value_type> try_pop() {
+			size_type pos = dequeue_pos.load(std::memory_order_relaxed);
+			do {
+				slot_type & slot = slots[remainder<N>(pos)];
+				const difference_type diff = sign(slot.sequence.load(std::memory_order_acquire) - (pos + 1));
+
+				/*  */ if (!diff) {
+					if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						std::optional<value_type> v{std::in_place, std::move(slot.value)};
+						std_r::destroy_at(std::addressof(slot.value));
+						slot.sequence.store(pos + capacity(), std::memory_order_release);
+						return v;
+					}
+
+				} else if (diff < 0) {
+					return std::nullopt;
+
+				} else {
+					pos = dequeue_pos.load(std::memory_order_relaxed);
+				}
+			} while (true);
+		}
+
+
+
+		// Special member functions
+		// Klasė nėra movable, nes atominių kintamųjų negalima perkelti.
+		// Vietos konstruojamos fixed_array konstruktoriuje tik jei atmintis išskirta, todėl čia užtenka patikrinti has_ownership.
+		constexpr mpmc_queue()
+			: enqueue_pos{0}, dequeue_pos{0}, slots{capacity()}
+		{
+			if (!has_ownership())
+				return;
+
+			for (size_type i = 0; i != capacity(); ++i)
+				slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		// Destruktorius kviečiamas kai kitos gijos eilės nebenaudoja, todėl likę elementai yra tarp dviejų pozicijų.
+		constexpr ~mpmc_queue() {
+			const size_type last = enqueue_pos.load(std::memory_order_relaxed);
+			for (size_type i = dequeue_pos.load(std::memory_order_relaxed); i != last; ++i)
+				std_r::destroy_at(std::addressof(slots[remainder<N>(i)].value));
+		}
+
+
+
+		// Member objects
+	protected:
+		alignas(cache_line_size()) std::atomic<size_type> enqueue_pos;
+		alignas(cache_line_size()) std::atomic<size_type> dequeue_pos;
+		alignas(cache_line_size()) array_type slots;
+	};
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+
+
+
+namespace aa {
+
+	// https://en.wikipedia.org/wiki/Memory_pool
+	// Dydžio klasės yra dvejeto laipsniai nuo min_size() iki MAX_SIZE baitų, didesni blokai išskiriami tiesiogiai su operator new.
+	// Kiekviena gija turi savo laisvų blokų sąrašus, todėl pakartotinai išskiriant ir atlaisvinant atmintį nereikia sinchronizacijos
+	// ir nekviečiamas globalus operator new. Kitoje gijoje atlaisvintas blokas patenka į tos gijos sąrašą.
+	// Gijai baigiantis jos sąrašuose esantys blokai grąžinami su operator delete.
+	template<size_t ALIGNMENT, size_t MAX_SIZE>
+		requires (std::has_single_bit(ALIGNMENT) && std::has_single_bit(MAX_SIZE))
+	struct size_class_pool {
+		// Member constants
+		static consteval size_t min_size() { return std::max(ALIGNMENT, sizeof(void *)); }
+		static consteval size_t max_size() { return MAX_SIZE; }
+		static consteval size_t class_count() { return int_log2(max_size()) - int_log2(min_size()) + 1; }
+
+		static constexpr size_t class_index(const size_t bytes) {
+			return int_log2(std::bit_ceil(std::max(bytes, min_size()))) - c(int_log2(min_size()));
+		}
+
+		static constexpr size_t class_size(const size_t index) {
+			return min_size() << index;
+		}
+
+
+
+		// Member functions
+		static constexpr void * allocate(const size_t bytes) {
+			if (bytes > max_size())
+				return __builtin_operator_new(bytes, std::align_val_t{ALIGNMENT}, std::nothrow);
+
+			const size_t index = class_index(bytes);
+			if (free_block * const block = lists.heads[index]) {
+				lists.heads[index] = block->next;
+				return block;
+			}
+			return __builtin_operator_new(class_size(index), std::align_val_t{ALIGNMENT}, std::nothrow);
+		}
+
+		// bytes turi būti toks pat kaip ir išskiriant atmintį, nes pagal jį nustatoma dydžio klasė.
+		static constexpr void deallocate(void * const p, const size_t bytes) {
+			if (bytes > max_size()) {
+				__builtin_operator_delete(p, bytes, std::align_val_t{ALIGNMENT});
+				return;
+			}
+
+			const size_t index = class_index(bytes);
+			lists.heads[index] = std_r::construct_at(std::bit_cast<free_block *>(p), lists.heads[index]);
+		}
+
+
+
+		// Member objects
+	private:
+		struct free_block {
+			free_block * next;
+		};
+
+		struct lists_type {
+			constexpr ~lists_type() {
+				for (size_t index = 0; index != class_count(); ++index) {
+					for (free_block * block = heads[index]; block;) {
+						free_block * const next = block->next;
+						__builtin_operator_delete(block, class_size(index), std::align_val_t{ALIGNMENT});
+						block = next;
+					}
+				}
+			}
+
+			std::array<free_block *, class_count()> heads = {};
+		};
+
+		static inline thread_local lists_type lists;
+	};
+
+
+
+	// Neturime deallocate(p) metodo, nes be dydžio neišeitų nustatyti dydžio klasės, o default_deallocate
+	// tokiu atveju kviestų deallocate(p, 0). fixed_array atlaisvindamas atmintį visada paduoda dydį.
+	template<class T, size_t MAX_SIZE = int_exp2(16u)>
+	struct pool_allocator {
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+		using pool_type = size_class_pool<std::max(alignof(value_type), alignof(void *)), MAX_SIZE>;
+
+
+
+		// Member functions
+		static constexpr pointer allocate(const size_type n) {
+			return std::bit_cast<pointer>(pool_type::allocate(product<sizeof(value_type)>(n)));
+		}
+
+		static constexpr void deallocate(const pointer p, const size_type n) {
+			pool_type::deallocate(p, product<sizeof(value_type)>(n));
+		}
+	};
+
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "fixed_vector.hpp"
+#include "aligned_allocator.hpp"
+
+
+
+namespace aa {
+
+	// https://en.wikipedia.org/wiki/AoS_and_SoA
+	// Kiekvienas tuple stulpelis laikomas atskirame fixed_vector, kurio pradžia sulygiuota pagal podėlio eilutę,
+	// todėl cikluose, kuriuose naudojami tik keli laukai, neskaitomi kiti laukai ir ciklus galima vektorizuoti.
+	//
+	// Elementų nėra kur laikyti kaip tuple, todėl grąžinamos tuple<T &...> proxy nuorodos, kurios yra tuple_like ir veikia su get_element.
+	// Neturime iteratorių, nes cikluose reikėtų naudoti stulpelių std::span, o ne proxy nuorodas.
+	template<not_cref... T>
+		requires (!!sizeof...(T))
+	struct soa_vector {
+		// Member types
+		using value_type = tuple<T...>;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = tuple<T &...>;
+		using const_reference = tuple<const T &...>;
+
+		template<class U>
+		using column_allocator_type = aligned_allocator<U, cache_line_size()>;
+
+		template<size_t I>
+		using column_type = fixed_vector<T...[I], column_allocator_type<T...[I]>>;
+
+
+
+		// Element access
+		template<class S>
+		constexpr auto operator[](this S && self, const size_type pos) {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			return tuple<forward_like_t<S, T>...>{std::forward_like<S>(self.columns.template get<I>()[pos])...};
+		}
+
+		template<class S>
+		constexpr auto front(this S && self) {
+			return std::forward<S>(self)[0];
+		}
+
+		template<class S>
+		constexpr auto back(this S && self) {
+			return std::forward<S>(self)[self.back_index()];
+		}
+
+		template<size_t I, class S>
+		constexpr auto column(this S && self) {
+			return std::span{self.columns.template get<I>().data(), self.size()};
+		}
+
+
+
+		// Capacity
+		// Visi stulpeliai turi tiek pat elementų, todėl užtenka paklausti pirmo stulpelio.
+		constexpr bool empty() const { return columns.template get<0>().empty(); }
+		constexpr bool full() const { return columns.template get<0>().full(); }
+
+		constexpr size_type size() const { return columns.template get<0>().size(); }
+		constexpr size_type back_index() const { return columns.template get<0>().back_index(); }
+
+		constexpr size_type capacity() const { return columns.template get<0>().capacity(); }
+
+		// capacity - size
+		constexpr size_type space() const { return columns.template get<0>().space(); }
+
+		constexpr bool has_ownership() const {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			return (... && columns.template get<I>().has_ownership());
+		}
+
+
+
+		// Modifiers
+		constexpr void clear() {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			(columns.template get<I>().clear(), ...);
+		}
+
+		// Kiekvienam stulpeliui paduodamas vienas argumentas.
+		template<class... A>
+			requires (sizeof...(A) == sizeof...(T) && (... && std::constructible_from<T, A>))
+		constexpr reference emplace_back(A &&... args) {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			(columns.template get<I>().emplace_back(std::forward<A>(args)), ...);
+			return back();
+		}
+
+		template<bool CHECKED = true>
+		constexpr void pop_back(const size_type count = 1) {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			(columns.template get<I>().template pop_back<CHECKED>(count), ...);
+		}
+
+		template<bool CHECKED = true>
+		constexpr void push_back(const size_type count = 1) {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			(columns.template get<I>().template push_back<CHECKED>(count), ...);
+		}
+
+		constexpr size_type pop(const size_type pos, const size_type count = 1) {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			(columns.template get<I>().pop(columns.template get<I>().data() + pos, count), ...);
+			return pos;
+		}
+
+		constexpr size_type fast_pop(const size_type pos, const size_type count = 1) {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			(columns.template get<I>().fast_pop(columns.template get<I>().data() + pos, count), ...);
+			return pos;
+		}
+
+
+
+		// Special member functions
+		constexpr soa_vector() = default;
+
+		// Stulpeliai pirma sukonstruojami tušti ir tik tada priskiriami, nes tuple konstruktoriui neišeina tą patį dydį perduoti kiekvienam stulpeliui.
+		template<bool CHECKED = true>
+		constexpr soa_vector(const size_type s, const size_type count = 0, constant<CHECKED> = default_value) {
+			constexpr auto [...I] = c<std::index_sequence_for<T...>>();
+			((columns.template get<I>() = column_type<I>{s, count, constant<CHECKED>{}}), ...);
+		}
+
+
+
+		// Member objects
+	protected:
+		tuple<fixed_vector<T, column_allocator_type<T>>...> columns;
+	};
+
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "../metaprogramming/general.hpp"
+#include "../algorithm/arithmetic.hpp"
+#include "fixed_array.hpp"
+#include <atomic>
+#include <expected>
+#include <system_error>
+
+
+
+namespace aa {
+
+	// https://rigtorp.se/ringbuffer/
+	// https://en.wikipedia.org/wiki/Circular_buffer
+	// Indeksai niekada neapvyniojami, jie tik didinami, o elemento vieta gaunama su remainder, todėl N turi būti dvejeto laipsnis.
+	// Taip tuščią ir pilną buferį galima atskirti neaukojant vienos vietos.
+	//
+	// Elementai laikomi fixed_array, kurio visi elementai visada sukonstruoti, todėl T turi būti default_initializable.
+	// Įdedant elementas priskiriamas, o išimant iš jo perkeliama, tai nereikia sekti kurie elementai gyvi.
+	//
+	// push_range ir pop_range metodai apdoroja visą paketą ir tik tada vieną kartą atlieka release store.
+	// Nepavykus išskirti atminties, fixed_array elementų nekonstruoja, has_ownership grąžina false ir buferio naudoti negalima.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpadded"
+	template<not_cref T, size_t N, class_like ALLOC = nothrow_allocator<T>>
+		requires (std::has_single_bit(N) && std::default_initializable<T>)
+	struct spsc_ring_buffer {
+#pragma GCC diagnostic pop
+		// Member types
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reference = value_type &;
+		using const_reference = const value_type &;
+		using pointer = value_type *;
+		using const_pointer = const value_type *;
+		using allocator_type = ALLOC;
+		using array_type = fixed_array<value_type, allocator_type>;
+		using error_type = std::errc;
+
+
+
+		// Capacity
+		// Kviečiant ne iš gamintojo ar vartotojo gijos, gaunama reikšmė gali būti jau pasenusi.
+		// head skaitomas pirmas, nes kitaip skirtumas galėtų tapti neigiamas.
+		constexpr size_type size() const {
+			const size_type h = head.load(std::memory_order_acquire);
+			return min(tail.load(std::memory_order_acquire) - h, capacity());
+		}
+
+		constexpr bool empty() const { return !size(); }
+		constexpr bool full() const { return size() == capacity(); }
+
+		static consteval size_type capacity() { return N; }
+
+		constexpr bool has_ownership() const {
+			return elements.has_ownership();
+		}
+
+
+
+		// Modifiers
+		// Šiuos metodus gali kviesti tik gamintojo gija.
+		template<class... A>
+			requires (std::constructible_from<value_type, A...>)
+		constexpr std::expected<void, error_type> try_emplace(A &&... args) {
+			const size_type t = tail.load(std::memory_order_relaxed);
+			if (t - cached_head == capacity()) {
+				cached_head = head.load(std::memory_order_acquire);
+				if (t - cached_head == capacity())
+					return std::expected<void, error_type>{std::unexpect, std::errc::resource_unavailable_try_again};
+			}
+
+			elements[remainder<N>(t)] = value_type{std::forward<A>(args)...};
+			tail.store(t + 1, std::memory_order_release);
+			return std::expected<void, error_type>{std::in_place};
+		}
+
+		// Grąžinamas įdėtų elementų skaičius, jis gali būti mažesnis už r dydį, jei buferyje pritrūko vietos.
+		template<std_r::input_range R>
+			requires (std::assignable_from<reference, std_r::range_reference_t<R>>)
+		constexpr size_type push_range(R && r) {
+			const size_type t = tail.load(std::memory_order_relaxed);
+			cached_head = head.load(std::memory_order_acquire);
+
+			std_r::iterator_t<R> i = std_r::begin(r);
+			const std_r::sentinel_t<R> end = std_r::end(r);
+			size_type j = t;
+			for (const size_type last = cached_head + capacity(); j != last && i != end; ++j, ++i)
+				elements[remainder<N>(j)] = *i;
+
+			tail.store(j, std::memory_order_release);
+			return j - t;
+		}
+
+		// Šiuos metodus gali kviesti tik vartotojo gija.
+		constexpr std::optional<value_type> try_pop() {
+			const size_type h = head.load(std::memory_order_relaxed);
+			if (h == cached_tail) {
+				cached_tail = tail.load(std::memory_order_acquire);
+				if (h == cached_tail)
+					return std::nullopt;
+			}
+
+			std::optional<value_type> v{std::in_place, std::move(elements[remainder<N>(h)])};
+			head.store(h + 1, std::memory_order_release);
+			return v;
+		}
+
+		// Grąžinamas išimtų elementų skaičius, jis gali būti mažesnis už r dydį, jei buferyje pritrūko elementų.
+		template<std_r::output_range<value_type> R>
+		constexpr size_type pop_range(R && r) {
+			const size_type h = head.load(std::memory_order_relaxed);
+			cached_tail = tail.load(std::memory_order_acquire);
+
+			std_r::iterator_t<R> i = std_r::begin(r);
+			const std_r::sentinel_t<R> end = std_r::end(r);
+			size_type j = h;
+			for (; j != cached_tail && i != end; ++j, ++i)
+				*i = std::move(elements[remainder<N>(j)]);
+
+			head.store(j, std::memory_order_release);
+			return j - h;
+		}
+
+
+
+		// Special member functions
+		// Klasė nėra movable, nes atominių kintamųjų negalima perkelti.
+		constexpr spsc_ring_buffer()
+			: head{0}, cached_tail{0}, tail{0}, cached_head{0}, elements{capacity()} {}
+
+
+
+		// Member objects
+		// Vartotojo ir gamintojo kintamieji laikomi skirtingose podėlio eilutėse, kad gijos viena kitai jų neinvaliduotų.
+		// Kiekviena gija taip pat laiko kitos gijos indekso kopiją, kad atominį kintamąjį reiktų skaityti tik kai buferis atrodo pilnas ar tuščias.
+	protected:
+		alignas(cache_line_size()) std::atomic<size_type> head;
+		size_type cached_tail;
+
+		alignas(cache_line_size()) std::atomic<size_type> tail;
+		size_type cached_head;
+
+		alignas(cache_line_size()) array_type elements;
+	};
+
+}
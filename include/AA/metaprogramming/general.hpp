@@ -235,6 +235,14 @@ namespace aa {
 	template<class T>
 	concept trivially_copyable = std::is_trivially_copyable_v<T>;
 
+	// https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2024/p1144r10.html
+	// Kintamąjį galima specializuoti tipams, kurių perkėlimas su sunaikinimu yra lygus baitų nukopijavimui, nors jie ir nėra trivially_copyable.
+	template<class T>
+	constexpr bool enable_trivially_relocatable = trivially_copyable<T>;
+
+	template<class T>
+	concept trivially_relocatable = enable_trivially_relocatable<std::remove_cv_t<T>>;
+
 	template<class L, class R>
 	concept wo_cvref_same_as = std::same_as<std::remove_cvref_t<L>, R>;
 
@@ -699,6 +707,15 @@ namespace aa {
 		return std::numeric_limits<T>::digits;
 	}
 
+	// GCC įspėja, kad konstantos reikšmė gali skirtis prie skirtingų -mtune nustatymų. Konstanta naudojama
+	// tik tam, kad atskirti skirtingų gijų keičiamus kintamuosius, todėl toks skirtumas mums nesvarbus.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+	consteval size_t cache_line_size() {
+		return std::hardware_destructive_interference_size;
+	}
+#pragma GCC diagnostic pop
+
 
 
 	// Kartais patogiau naudoti lambda su generic tipo parametru, bet ne atvejais, kai skiriasi parametrų skaičiai.
@@ -1337,6 +1354,28 @@ namespace aa {
 		}
 	}
 
+	// Perkelia [first, last) elementus į result ir juos sunaikina. Sritys gali persidengti.
+	// Kompiliavimo metu baitų kopijuoti negalima, todėl tada elementai perkeliami ir sunaikinami po vieną.
+	template<trivially_relocatable T>
+	constexpr T * trivially_relocate(T * const first, T * const last, T * const result) {
+		if consteval {
+			if (result < first) {
+				for (T * i = first, * j = result; i != last; ++i, ++j) {
+					std_r::construct_at(j, std::move(*i));
+					std_r::destroy_at(i);
+				}
+			} else {
+				for (T * i = last, * j = result + (last - first); i != first;) {
+					std_r::construct_at(--j, std::move(*--i));
+					std_r::destroy_at(i);
+				}
+			}
+		} else {
+			__builtin_memmove(result, first, sizeof(T) * unsign(last - first));
+		}
+		return result + (last - first);
+	}
+
 
 
 	// Galėtume vietoje _1 naudoti std::ignore. Bet minėtos konstantos tipas nėra tuščias.
@@ -1447,14 +1486,22 @@ namespace aa {
 
 
 
+	// 128 bitų sveikieji skaičiai nėra standartiniai, todėl be __extension__ gautume -Wpedantic perspėjimus.
+	__extension__ typedef __int128 int128_t;
+	__extension__ typedef unsigned __int128 uint128_t;
+
 	template<class T, class... A>
 	using next_type_t = A...[(get_type_index<T, A...>() + 1)];
 
 	template<std::integral T>
-	using next_int_t = copy_unsigned_t<T, next_type_t<std::make_signed_t<T>, int8_t, int16_t, int32_t, int64_t>>;
+	using next_int_t = copy_unsigned_t<T, next_type_t<std::make_signed_t<T>, int8_t, int16_t, int32_t, int64_t, int128_t>>;
+
+	template<std::integral T>
+	using prev_int_t = copy_unsigned_t<T, next_type_t<std::make_signed_t<T>, int128_t, int64_t, int32_t, int16_t, int8_t>>;
 
+	// Tipas, kuriame telpa dviejų T reikšmių sandauga.
 	template<std::integral T>
-	using prev_int_t = copy_unsigned_t<T, next_type_t<std::make_signed_t<T>, int64_t, int32_t, int16_t, int8_t>>;
+	using next_unsigned_t = std::make_unsigned_t<next_int_t<T>>;
 
 	template<std::integral X>
 	constexpr auto uprank(const X x) {
@@ -1473,6 +1520,13 @@ namespace aa {
 		std::forward<A>(a).deallocate(p);
 	};
 
+	template<class A>
+	concept reallocate_exists = requires(A && a,
+		const pointer_in_use_t<std::allocator_traits<A>> p, const size_type_in_use_t<std::allocator_traits<A>> n)
+	{
+		{ std::forward<A>(a).reallocate(p, n, n) } -> std::same_as<pointer_in_use_t<std::allocator_traits<A>>>;
+	};
+
 	template<class_like ALLOC>
 	struct default_deallocate {
 		// Member types
@@ -10,6 +10,10 @@ namespace aa {
 	template<class G>
 	concept bits_generator = std::uniform_random_bit_generator<std::remove_reference_t<G>>;
 
+	// Generatorius, kurį galima pastumti per n žingsnių nekviečiant jo n kartų.
+	template<class G>
+	concept jumpable_generator = bits_generator<G> && requires(std::remove_reference_t<G> & g, const size_t n) { g.jump(n); };
+
 	template<class G>
 	concept full_range_generator = bits_generator<G>
 		&& (std::remove_reference_t<G>::min() == numeric_min) && (std::remove_reference_t<G>::max() == numeric_max);
@@ -46,4 +50,8 @@ namespace aa {
 	template<class G, class T>
 	concept generator_modulus_representable_by = (numeric_digits<T>() >= std::bit_width(generator_modulus_v<G>));
 
+	// Jei modulis netelpa į T, bet generatorius pilno intervalo, atmetami jauniausi bitai, kurių T vis tiek neišsaugotų.
+	template<class G, class T>
+	concept real_generatable_by = generator_modulus_representable_by<G, T> || full_range_generator<G>;
+
 }